@@ -29,6 +29,12 @@
 #include "httpd.h"
 #include "tcp_server.h"
 #include "http_ssi_cgi.h"
+#include "ADC_Scan.h"
+#include "Telemetry.h"
+#include "udp_publisher.h"
+#include "Scheduler.h"
+#include "Command.h"
+#include "Log.h"
 
 /* USER CODE END Includes */
 
@@ -53,18 +59,25 @@
 ADC_HandleTypeDef hadc1;
 ADC_HandleTypeDef hadc2;
 ADC_HandleTypeDef hadc3;
+DMA_HandleTypeDef hdma_adc1;
+DMA_HandleTypeDef hdma_adc3;
 
 DAC_HandleTypeDef hdac;
 
 SPI_HandleTypeDef hspi4;
 
 TIM_HandleTypeDef htim2;
+TIM_HandleTypeDef htim3;
+TIM_HandleTypeDef htim7;
+TIM_HandleTypeDef htim8;
 TIM_HandleTypeDef htim10;
 TIM_HandleTypeDef htim11;
+DMA_HandleTypeDef hdma_tim8_ch4_trig_com;
 
 UART_HandleTypeDef huart1;
 UART_HandleTypeDef huart2;
 UART_HandleTypeDef huart3;
+DMA_HandleTypeDef hdma_usart2_rx;
 
 /* USER CODE BEGIN PV */
 
@@ -78,6 +91,7 @@ char Rx_buffer[20];
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
+static void MX_DMA_Init(void);
 static void MX_USART3_UART_Init(void);
 static void MX_ADC1_Init(void);
 static void MX_ADC2_Init(void);
@@ -89,7 +103,15 @@ static void MX_USART1_UART_Init(void);
 static void MX_TIM2_Init(void);
 static void MX_TIM10_Init(void);
 static void MX_TIM11_Init(void);
+static void MX_TIM3_Init(void);
+static void MX_TIM7_Init(void);
+static void MX_TIM8_Init(void);
 /* USER CODE BEGIN PFP */
+static void Control_task(void);
+static void Wind_task(void);
+static void Publish_task(void);
+static void Network_task(void);
+static void Log_task(void);
 
 /* USER CODE END PFP */
 
@@ -99,7 +121,7 @@ PUTCHAR_PROTOTYPE
 {
   /* Place your implementation of fputc here */
   /* e.g. write a character to the USART1 and Loop until the end of transmission */
-  HAL_UART_Transmit(&huart3, (uint8_t *)&ch, 1, 0xFFFF);
+  Log_putchar(&huart3, (char)ch);
 
   return ch;
 }
@@ -133,6 +155,7 @@ int main(void)
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
+  MX_DMA_Init();
   MX_USART3_UART_Init();
   MX_ADC1_Init();
   MX_ADC2_Init();
@@ -145,12 +168,18 @@ int main(void)
   MX_TIM2_Init();
   MX_TIM10_Init();
   MX_TIM11_Init();
+  MX_TIM3_Init();
+  MX_TIM7_Init();
+  MX_TIM8_Init();
   /* USER CODE BEGIN 2 */
+  ADC_Scan_init(&htim3);
+  WSWD_init(&huart2);
   IO_init_distance_sensor(&hadc1);
   IO_init_current_sensor(&hadc3);
-  Linear_Guide_init(&hdac, &htim11);
+  Linear_Guide_init(&hdac, &htim11, &htim8);
   linear_guide = LG_get_Linear_Guide();
   manual_control = Manual_Control_init(linear_guide, &htim10);
+  Telemetry_init();
 
   printf("Sailwind Firmware Ver. 1.0\r\n");
 
@@ -177,17 +206,28 @@ int main(void)
 #endif
 
 #if WIND_TEST
-  char NMEA[31];
-  float speed = 0.0;
-  float dir = 0.0;
-  WSWD_receive_NMEA(NMEA);
-  printf("%s",NMEA);
-  WSWD_get_wind_infos(NMEA, &speed, &dir);
-  printf("speed:%f, dir:%f\r\n", speed, dir);
+  WSWD_wind_sample_t wind_sample;
+  HAL_Delay(WSWD_SAMPLE_TIMEOUT_MS);
+  WSWD_update();
+  if (WSWD_get_latest_sample(&wind_sample) == WSWD_OK)
+  {
+    printf("speed:%lu, dir:%u, unit:%c (x100, x10)\r\n",
+           wind_sample.speed_x100, wind_sample.direction_x10, wind_sample.unit);
+  }
 #endif
 
   tcp_server_init();
   http_server_init();
+  udp_publisher_init();
+
+  /* motion and sensors preempt the main loop, so a slow client cannot delay the motor ramp */
+  Scheduler_add_task("control", Control_task, 1U, 1U, 0U, Scheduler_context_tick_interrupt);
+  Scheduler_add_task("wind", Wind_task, 10U, 10U, 1U, Scheduler_context_tick_interrupt);
+  Scheduler_add_task("publish", Publish_task, 10U, 10U, 0U, Scheduler_context_main_loop);
+  Scheduler_add_task("network", Network_task, SCHEDULER_BACKGROUND, 0U, 1U, Scheduler_context_main_loop);
+  Scheduler_add_task("log", Log_task, SCHEDULER_BACKGROUND, 0U, 2U, Scheduler_context_main_loop);
+  Log_init(&huart3);
+  Scheduler_init(&htim7);
 
   /* USER CODE END 2 */
 
@@ -195,16 +235,7 @@ int main(void)
   /* USER CODE BEGIN WHILE */
   while (1)
   {
-      MX_LWIP_Process();
-      if (Linear_Guide_update(linear_guide) == LG_UPDATE_NORMAL)
-      {
-    	  //Test_uart_poll(&huart3, Rx_buffer, &manual_control);
-    	  Manual_Control_poll(&manual_control);
-    	  Manual_Control_Localization(&manual_control);
-      }
-      /*
-       * add tcp handling
-       */
+      Scheduler_run();
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
@@ -280,14 +311,14 @@ static void MX_ADC1_Init(void)
   hadc1.Init.ClockPrescaler = ADC_CLOCK_SYNC_PCLK_DIV4;
   hadc1.Init.Resolution = ADC_RESOLUTION_12B;
   hadc1.Init.ScanConvMode = ENABLE;
-  hadc1.Init.ContinuousConvMode = ENABLE;
+  hadc1.Init.ContinuousConvMode = DISABLE;
   hadc1.Init.DiscontinuousConvMode = DISABLE;
-  hadc1.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_NONE;
-  hadc1.Init.ExternalTrigConv = ADC_SOFTWARE_START;
+  hadc1.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_RISING;
+  hadc1.Init.ExternalTrigConv = ADC_EXTERNALTRIGCONV_T3_TRGO;
   hadc1.Init.DataAlign = ADC_DATAALIGN_RIGHT;
   hadc1.Init.NbrOfConversion = 2;
-  hadc1.Init.DMAContinuousRequests = DISABLE;
-  hadc1.Init.EOCSelection = ADC_EOC_SINGLE_CONV;
+  hadc1.Init.DMAContinuousRequests = ENABLE;
+  hadc1.Init.EOCSelection = ADC_EOC_SEQ_CONV;
   if (HAL_ADC_Init(&hadc1) != HAL_OK)
   {
     Error_Handler();
@@ -362,14 +393,14 @@ static void MX_ADC3_Init(void)
   hadc3.Init.ClockPrescaler = ADC_CLOCK_SYNC_PCLK_DIV4;
   hadc3.Init.Resolution = ADC_RESOLUTION_12B;
   hadc3.Init.ScanConvMode = ENABLE;
-  hadc3.Init.ContinuousConvMode = ENABLE;
+  hadc3.Init.ContinuousConvMode = DISABLE;
   hadc3.Init.DiscontinuousConvMode = DISABLE;
-  hadc3.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_NONE;
-  hadc3.Init.ExternalTrigConv = ADC_SOFTWARE_START;
+  hadc3.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_RISING;
+  hadc3.Init.ExternalTrigConv = ADC_EXTERNALTRIGCONV_T3_TRGO;
   hadc3.Init.DataAlign = ADC_DATAALIGN_RIGHT;
   hadc3.Init.NbrOfConversion = 3;
-  hadc3.Init.DMAContinuousRequests = DISABLE;
-  hadc3.Init.EOCSelection = ADC_EOC_SINGLE_CONV;
+  hadc3.Init.DMAContinuousRequests = ENABLE;
+  hadc3.Init.EOCSelection = ADC_EOC_SEQ_CONV;
   if (HAL_ADC_Init(&hadc3) != HAL_OK)
   {
     Error_Handler();
@@ -504,6 +535,149 @@ static void MX_TIM2_Init(void)
 
 }
 
+/**
+  * @brief TIM3 Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_TIM3_Init(void)
+{
+
+  /* USER CODE BEGIN TIM3_Init 0 */
+
+  /* USER CODE END TIM3_Init 0 */
+
+  TIM_ClockConfigTypeDef sClockSourceConfig = {0};
+  TIM_MasterConfigTypeDef sMasterConfig = {0};
+
+  /* USER CODE BEGIN TIM3_Init 1 */
+  /* 70 MHz / (69 + 1) / (999 + 1) = 1 kHz scan trigger for ADC1 and ADC3 */
+  /* USER CODE END TIM3_Init 1 */
+  htim3.Instance = TIM3;
+  htim3.Init.Prescaler = 69;
+  htim3.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim3.Init.Period = 999;
+  htim3.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  htim3.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+  if (HAL_TIM_Base_Init(&htim3) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sClockSourceConfig.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
+  if (HAL_TIM_ConfigClockSource(&htim3, &sClockSourceConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_UPDATE;
+  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+  if (HAL_TIMEx_MasterConfigSynchronization(&htim3, &sMasterConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN TIM3_Init 2 */
+
+  /* USER CODE END TIM3_Init 2 */
+
+}
+
+/**
+  * @brief TIM7 Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_TIM7_Init(void)
+{
+
+  /* USER CODE BEGIN TIM7_Init 0 */
+
+  /* USER CODE END TIM7_Init 0 */
+
+  TIM_MasterConfigTypeDef sMasterConfig = {0};
+
+  /* USER CODE BEGIN TIM7_Init 1 */
+  /* 70 MHz / (69 + 1) / (999 + 1) = 1 kHz tick of the scheduler */
+  /* USER CODE END TIM7_Init 1 */
+  htim7.Instance = TIM7;
+  htim7.Init.Prescaler = 69;
+  htim7.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim7.Init.Period = 999;
+  htim7.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+  if (HAL_TIM_Base_Init(&htim7) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
+  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+  if (HAL_TIMEx_MasterConfigSynchronization(&htim7, &sMasterConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN TIM7_Init 2 */
+
+  /* USER CODE END TIM7_Init 2 */
+
+}
+
+/**
+  * @brief TIM8 Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_TIM8_Init(void)
+{
+
+  /* USER CODE BEGIN TIM8_Init 0 */
+
+  /* USER CODE END TIM8_Init 0 */
+
+  TIM_ClockConfigTypeDef sClockSourceConfig = {0};
+  TIM_MasterConfigTypeDef sMasterConfig = {0};
+  TIM_IC_InitTypeDef sConfigIC = {0};
+
+  /* USER CODE BEGIN TIM8_Init 1 */
+  /* motor pulses on OUT_1 (PC9 = TIM8_CH4): every rising edge is captured and requests a DMA
+   * transfer, the remaining count of the DMA stream counts the pulses without an interrupt */
+  /* USER CODE END TIM8_Init 1 */
+  htim8.Instance = TIM8;
+  htim8.Init.Prescaler = 0;
+  htim8.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim8.Init.Period = 65535;
+  htim8.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  htim8.Init.RepetitionCounter = 0;
+  htim8.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+  if (HAL_TIM_Base_Init(&htim8) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sClockSourceConfig.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
+  if (HAL_TIM_ConfigClockSource(&htim8, &sClockSourceConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  if (HAL_TIM_IC_Init(&htim8) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
+  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+  if (HAL_TIMEx_MasterConfigSynchronization(&htim8, &sMasterConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sConfigIC.ICPolarity = TIM_INPUTCHANNELPOLARITY_RISING;
+  sConfigIC.ICSelection = TIM_ICSELECTION_DIRECTTI;
+  sConfigIC.ICPrescaler = TIM_ICPSC_DIV1;
+  sConfigIC.ICFilter = 15;
+  if (HAL_TIM_IC_ConfigChannel(&htim8, &sConfigIC, TIM_CHANNEL_4) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN TIM8_Init 2 */
+
+  /* USER CODE END TIM8_Init 2 */
+
+}
+
 /**
   * @brief TIM10 Initialization Function
   * @param None
@@ -665,6 +839,32 @@ static void MX_USART3_UART_Init(void)
 
 }
 
+/**
+  * Enable DMA controller clock
+  */
+static void MX_DMA_Init(void)
+{
+
+  /* DMA controller clock enable */
+  __HAL_RCC_DMA1_CLK_ENABLE();
+  __HAL_RCC_DMA2_CLK_ENABLE();
+
+  /* DMA interrupt init */
+  /* DMA1_Stream5_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Stream5_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream5_IRQn);
+  /* DMA2_Stream0_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA2_Stream0_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream0_IRQn);
+  /* DMA2_Stream1_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA2_Stream1_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream1_IRQn);
+  /* DMA2_Stream7_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA2_Stream7_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream7_IRQn);
+
+}
+
 /**
   * @brief GPIO Initialization Function
   * @param None
@@ -767,12 +967,6 @@ static void MX_GPIO_Init(void)
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
   HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
 
-  /*Configure GPIO pin : OUT_1_Pin */
-  GPIO_InitStruct.Pin = OUT_1_Pin;
-  GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING;
-  GPIO_InitStruct.Pull = GPIO_NOPULL;
-  HAL_GPIO_Init(OUT_1_GPIO_Port, &GPIO_InitStruct);
-
   /*Configure GPIO pin : IN_2_Pin */
   GPIO_InitStruct.Pin = IN_2_Pin;
   GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
@@ -794,23 +988,34 @@ static void MX_GPIO_Init(void)
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
   HAL_GPIO_Init(IN_0_GPIO_Port, &GPIO_InitStruct);
 
-  /* EXTI interrupt init*/
-  HAL_NVIC_SetPriority(EXTI9_5_IRQn, 0, 0);
-  HAL_NVIC_EnableIRQ(EXTI9_5_IRQn);
-
 /* USER CODE BEGIN MX_GPIO_Init_2 */
 /* USER CODE END MX_GPIO_Init_2 */
 }
 
 /* USER CODE BEGIN 4 */
-void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
-  Linear_Guide_callback_motor_pulse_capture(linear_guide);
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+  ADC_Scan_callback_conversion_complete(hadc);
+}
+
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+  WSWD_callback_receive_event(huart, Size);
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  WSWD_callback_error(huart);
 }
 
 void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
 {
   // Check which version of the timer triggered this callback and toggle LED
-  if (htim == &htim2 )
+  if (htim == &htim7)
+  {
+    Scheduler_tick_callback(htim);
+  }
+  else if (htim == &htim2 )
   {
     printf("executing reset\r\n");
     HAL_TIM_Base_Stop(&htim2);
@@ -826,6 +1031,59 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
 	  LED_blink_callback(htim);
   }
 }
+
+/**
+  * @brief motion control, runs every millisecond in the tick interrupt so the motor ramp steps on time
+  * @retval None
+  */
+static void Control_task(void)
+{
+  Command_process(linear_guide);
+  if (Linear_Guide_update(linear_guide) == LG_UPDATE_NORMAL)
+  {
+    //Test_uart_poll(&huart3, Rx_buffer, &manual_control);
+    Manual_Control_poll(&manual_control);
+    Manual_Control_Localization(&manual_control);
+  }
+  Telemetry_update();
+}
+
+/**
+  * @brief wind sensor samples, parsed in the tick interrupt like the rest of the control data
+  * @retval None
+  */
+static void Wind_task(void)
+{
+  WSWD_update();
+}
+
+/**
+  * @brief push telemetry to the streaming clients and the UDP subscribers
+  * @retval None
+  */
+static void Publish_task(void)
+{
+  tcp_server_update();
+  udp_publisher_update();
+}
+
+/**
+  * @brief lwIP input and timers, fills the time between the periodic tasks
+  * @retval None
+  */
+static void Network_task(void)
+{
+  MX_LWIP_Process();
+}
+
+/**
+  * @brief debug output of printf
+  * @retval None
+  */
+static void Log_task(void)
+{
+  Log_update();
+}
 /* USER CODE END 4 */
 
 /**
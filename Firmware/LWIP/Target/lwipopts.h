@@ -108,6 +108,8 @@
 #define CHECKSUM_CHECK_ICMP6 0
 /*-----------------------------------------------------------------------------*/
 /* USER CODE BEGIN 1 */
+/* httpd, REST connection slots, binary protocol and Modbus TCP client, listeners are separate */
+#define MEMP_NUM_TCP_PCB 8
 
 /* USER CODE END 1 */
 
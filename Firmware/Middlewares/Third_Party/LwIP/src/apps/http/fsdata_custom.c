@@ -74,7 +74,7 @@ Pragma: no-cache
 0x30,0x38,0x20,0x31,0x34,0x3a,0x30,0x30,0x3a,0x30,0x30,0x20,0x47,0x4d,0x54,0x0d,
 0x0a,0x50,0x72,0x61,0x67,0x6d,0x61,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,
 0x65,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (1697 bytes) */
+/* raw file data (3026 bytes) */
 0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0d,
 0x0a,0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,0x09,0x3c,0x73,0x74,0x79,0x6c,0x65,
 0x3e,0x0d,0x0a,0x09,0x09,0x68,0x65,0x61,0x64,0x20,0x7b,0x6d,0x61,0x72,0x67,0x69,
@@ -176,12 +176,95 @@ Pragma: no-cache
 0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x3e,0x3c,0x68,0x33,0x3e,0x50,0x6f,
 0x73,0x69,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x68,0x3e,
 0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,
-0x64,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x70,0x6f,0x73,0x2d,0x2d,
-0x3e,0x25,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,0x0d,
-0x0a,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,
-0x3e,};
+0x64,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x69,0x64,0x3d,0x22,
+0x70,0x6f,0x73,0x22,0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x70,0x6f,0x73,0x2d,0x2d,0x3e,
+0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x25,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,
+0x64,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
+0x74,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,
+0x61,0x62,0x6c,0x65,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
+0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,
+0x69,0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x22,0x3e,0x0d,0x0a,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,
+0x74,0x79,0x70,0x65,0x3d,0x22,0x72,0x61,0x6e,0x67,0x65,0x22,0x20,0x69,0x64,0x3d,
+0x22,0x73,0x61,0x69,0x6c,0x5f,0x70,0x6f,0x73,0x22,0x20,0x6d,0x69,0x6e,0x3d,0x22,
+0x2d,0x31,0x30,0x30,0x22,0x20,0x6d,0x61,0x78,0x3d,0x22,0x31,0x30,0x30,0x22,0x20,
+0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x30,0x22,0x20,0x6f,0x6e,0x69,0x6e,0x70,0x75,
+0x74,0x3d,0x22,0x73,0x61,0x69,0x6c,0x5f,0x70,0x6f,0x73,0x5f,0x76,0x61,0x6c,0x75,
+0x65,0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,0x74,0x68,
+0x69,0x73,0x2e,0x76,0x61,0x6c,0x75,0x65,0x22,0x20,0x6f,0x6e,0x63,0x68,0x61,0x6e,
+0x67,0x65,0x3d,0x22,0x73,0x65,0x6e,0x64,0x5f,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,
+0x28,0x27,0x73,0x61,0x69,0x6c,0x5f,0x70,0x6f,0x73,0x27,0x2c,0x20,0x74,0x68,0x69,
+0x73,0x2e,0x76,0x61,0x6c,0x75,0x65,0x29,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x20,0x69,0x64,0x3d,0x22,
+0x73,0x61,0x69,0x6c,0x5f,0x70,0x6f,0x73,0x5f,0x76,0x61,0x6c,0x75,0x65,0x22,0x3e,
+0x30,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x25,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x3c,0x70,0x20,0x69,0x64,0x3d,0x22,0x6c,0x69,0x6e,0x6b,0x5f,0x73,0x74,0x61,
+0x74,0x65,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2d,
+0x61,0x6c,0x69,0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x22,0x3e,0x6f,
+0x66,0x66,0x6c,0x69,0x6e,0x65,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2a,0x20,0x73,0x74,0x61,0x74,0x65,
+0x20,0x61,0x6e,0x64,0x20,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x73,0x20,0x6f,0x76,
+0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x57,0x65,0x62,0x53,0x6f,0x63,0x6b,0x65,0x74,
+0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x52,0x45,0x53,0x54,0x20,0x73,0x65,0x72,
+0x76,0x65,0x72,0x2c,0x20,0x6e,0x6f,0x20,0x70,0x61,0x67,0x65,0x20,0x72,0x65,0x6c,
+0x6f,0x61,0x64,0x20,0x2a,0x2f,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x76,0x61,0x72,0x20,0x73,0x6f,0x63,0x6b,0x65,0x74,0x3b,0x0d,0x0a,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
+0x6e,0x20,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x28,0x29,0x20,0x7b,0x0d,0x0a,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x6f,0x63,0x6b,0x65,
+0x74,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x57,0x65,0x62,0x53,0x6f,0x63,0x6b,0x65,
+0x74,0x28,0x22,0x77,0x73,0x3a,0x2f,0x2f,0x22,0x20,0x2b,0x20,0x6c,0x6f,0x63,0x61,
+0x74,0x69,0x6f,0x6e,0x2e,0x68,0x6f,0x73,0x74,0x6e,0x61,0x6d,0x65,0x20,0x2b,0x20,
+0x22,0x3a,0x32,0x33,0x37,0x35,0x2f,0x64,0x61,0x74,0x61,0x2f,0x77,0x73,0x22,0x29,
+0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,
+0x6f,0x63,0x6b,0x65,0x74,0x2e,0x6f,0x6e,0x6f,0x70,0x65,0x6e,0x20,0x3d,0x20,0x66,
+0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x20,0x7b,0x20,0x6c,0x69,0x6e,0x6b,
+0x5f,0x73,0x74,0x61,0x74,0x65,0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,0x65,
+0x6e,0x74,0x20,0x3d,0x20,0x22,0x6c,0x69,0x76,0x65,0x22,0x3b,0x20,0x7d,0x3b,0x0d,
+0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x6f,0x63,
+0x6b,0x65,0x74,0x2e,0x6f,0x6e,0x63,0x6c,0x6f,0x73,0x65,0x20,0x3d,0x20,0x66,0x75,
+0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x20,0x7b,0x20,0x6c,0x69,0x6e,0x6b,0x5f,
+0x73,0x74,0x61,0x74,0x65,0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,0x65,0x6e,
+0x74,0x20,0x3d,0x20,0x22,0x6f,0x66,0x66,0x6c,0x69,0x6e,0x65,0x22,0x3b,0x20,0x73,
+0x65,0x74,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x28,0x63,0x6f,0x6e,0x6e,0x65,0x63,
+0x74,0x2c,0x20,0x32,0x30,0x30,0x30,0x29,0x3b,0x20,0x7d,0x3b,0x0d,0x0a,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x6f,0x63,0x6b,0x65,0x74,
+0x2e,0x6f,0x6e,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x3d,0x20,0x66,0x75,0x6e,
+0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x20,0x7b,0x0d,0x0a,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,
+0x72,0x20,0x73,0x74,0x61,0x74,0x65,0x20,0x3d,0x20,0x4a,0x53,0x4f,0x4e,0x2e,0x70,
+0x61,0x72,0x73,0x65,0x28,0x65,0x76,0x65,0x6e,0x74,0x2e,0x64,0x61,0x74,0x61,0x29,
+0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x69,0x66,0x20,0x28,0x22,0x73,0x61,0x69,0x6c,0x5f,0x70,0x6f,0x73,0x22,0x20,
+0x69,0x6e,0x20,0x73,0x74,0x61,0x74,0x65,0x29,0x20,0x7b,0x20,0x70,0x6f,0x73,0x2e,
+0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x3d,0x20,0x73,0x74,
+0x61,0x74,0x65,0x2e,0x73,0x61,0x69,0x6c,0x5f,0x70,0x6f,0x73,0x3b,0x20,0x7d,0x0d,
+0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+0x66,0x20,0x28,0x22,0x72,0x65,0x73,0x75,0x6c,0x74,0x22,0x20,0x69,0x6e,0x20,0x73,
+0x74,0x61,0x74,0x65,0x20,0x26,0x26,0x20,0x73,0x74,0x61,0x74,0x65,0x2e,0x72,0x65,
+0x73,0x75,0x6c,0x74,0x20,0x21,0x3d,0x20,0x22,0x6f,0x6b,0x22,0x29,0x20,0x7b,0x20,
+0x6c,0x69,0x6e,0x6b,0x5f,0x73,0x74,0x61,0x74,0x65,0x2e,0x74,0x65,0x78,0x74,0x43,
+0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x3d,0x20,0x22,0x63,0x6f,0x6d,0x6d,0x61,0x6e,
+0x64,0x20,0x72,0x65,0x6a,0x65,0x63,0x74,0x65,0x64,0x22,0x3b,0x20,0x7d,0x0d,0x0a,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x3b,0x0d,0x0a,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
+0x73,0x65,0x6e,0x64,0x5f,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x28,0x6b,0x65,0x79,
+0x2c,0x20,0x76,0x61,0x6c,0x75,0x65,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x73,0x6f,0x63,0x6b,
+0x65,0x74,0x2e,0x72,0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x20,0x3d,0x3d,
+0x20,0x57,0x65,0x62,0x53,0x6f,0x63,0x6b,0x65,0x74,0x2e,0x4f,0x50,0x45,0x4e,0x29,
+0x20,0x7b,0x20,0x73,0x6f,0x63,0x6b,0x65,0x74,0x2e,0x73,0x65,0x6e,0x64,0x28,0x27,
+0x7b,0x22,0x27,0x20,0x2b,0x20,0x6b,0x65,0x79,0x20,0x2b,0x20,0x27,0x22,0x3a,0x27,
+0x20,0x2b,0x20,0x4e,0x75,0x6d,0x62,0x65,0x72,0x28,0x76,0x61,0x6c,0x75,0x65,0x29,
+0x20,0x2b,0x20,0x27,0x7d,0x27,0x29,0x3b,0x20,0x7d,0x0d,0x0a,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x28,0x29,0x3b,0x0d,0x0a,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,
+0x0d,0x0a,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x68,0x74,0x6d,
+0x6c,0x3e,};
 
 static const unsigned int dummy_align__index_html = 2;
 static const unsigned char data__index_html[] = {
@@ -438,7 +521,7 @@ Pragma: no-cache
 0x30,0x38,0x20,0x31,0x34,0x3a,0x30,0x30,0x3a,0x30,0x30,0x20,0x47,0x4d,0x54,0x0d,
 0x0a,0x50,0x72,0x61,0x67,0x6d,0x61,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,
 0x65,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (2508 bytes) */
+/* raw file data (2891 bytes) */
 0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0d,
 0x0a,0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,0x09,0x3c,0x73,0x74,0x79,0x6c,0x65,
 0x3e,0x0d,0x0a,0x09,0x09,0x68,0x65,0x61,0x64,0x20,0x7b,0x6d,0x61,0x72,0x67,0x69,
@@ -555,47 +638,71 @@ Pragma: no-cache
 0x20,0x20,0x20,0x3c,0x74,0x64,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x21,0x2d,0x2d,0x23,
 0x77,0x69,0x6e,0x64,0x64,0x69,0x72,0x2d,0x2d,0x3e,0x26,0x23,0x31,0x37,0x36,0x3b,
 0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x09,0x09,0x20,
-0x20,0x3c,0x74,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x74,0x68,0x3e,0x3c,0x68,0x33,0x3e,0x44,0x69,0x73,0x74,0x61,
-0x6e,0x63,0x65,0x20,0x4d,0x6f,0x74,0x6f,0x72,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,
-0x74,0x68,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x74,0x64,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x64,0x69,
-0x73,0x6d,0x2d,0x2d,0x3e,0x6d,0x6d,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x64,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,
-0x72,0x3e,0x0d,0x0a,0x09,0x09,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x3e,0x3c,0x68,
-0x33,0x3e,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x53,0x65,0x6e,0x73,0x6f,
-0x72,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x68,0x3e,0x0d,0x0a,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x3e,0x3c,0x68,0x33,
+0x3e,0x4d,0x65,0x61,0x6e,0x20,0x57,0x69,0x6e,0x64,0x20,0x53,0x70,0x65,0x65,0x64,
+0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x68,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,0x3e,0x3c,0x68,0x33,0x3e,
+0x3c,0x21,0x2d,0x2d,0x23,0x77,0x69,0x6e,0x64,0x61,0x76,0x67,0x2d,0x2d,0x3e,0x6d,
+0x2f,0x73,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0d,0x0a,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x3e,0x3c,
+0x68,0x33,0x3e,0x4d,0x61,0x78,0x20,0x57,0x69,0x6e,0x64,0x20,0x53,0x70,0x65,0x65,
+0x64,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x68,0x3e,0x0d,0x0a,0x20,0x20,0x20,
 0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,0x3e,0x3c,0x68,0x33,
-0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x64,0x69,0x73,0x73,0x2d,0x2d,0x3e,0x6d,0x6d,0x3c,
+0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x77,0x69,0x6e,0x64,0x6d,0x61,0x78,0x2d,0x2d,0x3e,
+0x6d,0x2f,0x73,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0d,0x0a,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x3e,
+0x3c,0x68,0x33,0x3e,0x4c,0x61,0x73,0x74,0x20,0x47,0x75,0x73,0x74,0x3c,0x2f,0x68,
+0x33,0x3e,0x3c,0x2f,0x74,0x68,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x21,0x2d,
+0x2d,0x23,0x77,0x69,0x6e,0x64,0x67,0x73,0x74,0x2d,0x2d,0x3e,0x6d,0x2f,0x73,0x3c,
 0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
 0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x09,0x09,0x20,0x20,
 0x3c,0x74,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x3c,0x74,0x68,0x3e,0x3c,0x68,0x33,0x3e,0x4f,0x70,0x65,0x72,0x61,0x74,
-0x69,0x6e,0x67,0x20,0x4d,0x6f,0x64,0x65,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,
+0x20,0x20,0x3c,0x74,0x68,0x3e,0x3c,0x68,0x33,0x3e,0x44,0x69,0x73,0x74,0x61,0x6e,
+0x63,0x65,0x20,0x4d,0x6f,0x74,0x6f,0x72,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,
 0x68,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x74,0x64,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x6f,0x70,0x6d,
-0x6f,0x64,0x2d,0x2d,0x3e,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,
-0x0d,0x0a,0x09,0x09,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x3e,0x3c,0x68,0x33,0x3e,
-0x4d,0x61,0x78,0x20,0x52,0x50,0x4d,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x68,
+0x3c,0x74,0x64,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x64,0x69,0x73,
+0x6d,0x2d,0x2d,0x3e,0x6d,0x6d,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x64,0x3e,
+0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,
+0x3e,0x0d,0x0a,0x09,0x09,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x3e,0x3c,0x68,0x33,
+0x3e,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x53,0x65,0x6e,0x73,0x6f,0x72,
+0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x68,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x64,0x3e,0x3c,0x68,0x33,0x3e,
+0x3c,0x21,0x2d,0x2d,0x23,0x64,0x69,0x73,0x73,0x2d,0x2d,0x3e,0x6d,0x6d,0x3c,0x2f,
+0x68,0x33,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x09,0x09,0x20,0x20,0x3c,
+0x74,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x3c,0x74,0x68,0x3e,0x3c,0x68,0x33,0x3e,0x4f,0x70,0x65,0x72,0x61,0x74,0x69,
+0x6e,0x67,0x20,0x4d,0x6f,0x64,0x65,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x68,
 0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x74,0x64,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x6d,0x61,0x78,0x72,
-0x70,0x6d,0x2d,0x2d,0x3e,0x55,0x2f,0x6d,0x69,0x6e,0x3c,0x2f,0x68,0x33,0x3e,0x3c,
-0x2f,0x74,0x64,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x09,0x09,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,
-0x3e,0x3c,0x68,0x33,0x3e,0x4d,0x61,0x78,0x20,0x61,0x63,0x63,0x65,0x70,0x74,0x65,
-0x64,0x20,0x64,0x65,0x6c,0x74,0x61,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x68,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x74,0x64,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x6d,0x61,0x78,0x64,
-0x65,0x6c,0x2d,0x2d,0x3e,0x6d,0x6d,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x64,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,
-0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x61,
-0x62,0x6c,0x65,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,0x62,0x6f,0x64,0x79,
-0x3e,0x0d,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,};
+0x74,0x64,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x6f,0x70,0x6d,0x6f,
+0x64,0x2d,0x2d,0x3e,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x0d,0x0a,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0d,
+0x0a,0x09,0x09,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x3e,0x3c,0x68,0x33,0x3e,0x4d,
+0x61,0x78,0x20,0x52,0x50,0x4d,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x68,0x3e,
+0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,
+0x64,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x6d,0x61,0x78,0x72,0x70,
+0x6d,0x2d,0x2d,0x3e,0x55,0x2f,0x6d,0x69,0x6e,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,
+0x74,0x64,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
+0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x09,0x09,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0d,0x0a,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x3e,
+0x3c,0x68,0x33,0x3e,0x4d,0x61,0x78,0x20,0x61,0x63,0x63,0x65,0x70,0x74,0x65,0x64,
+0x20,0x64,0x65,0x6c,0x74,0x61,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x68,0x3e,
+0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,
+0x64,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x6d,0x61,0x78,0x64,0x65,
+0x6c,0x2d,0x2d,0x3e,0x6d,0x6d,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x74,0x64,0x3e,
+0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,
+0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x61,0x62,
+0x6c,0x65,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,
+0x0d,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,};
 
 static const unsigned int dummy_align__Settings_shtml = 5;
 static const unsigned char data__Settings_shtml[] = {
@@ -625,7 +732,7 @@ Pragma: no-cache
 0x30,0x38,0x20,0x31,0x34,0x3a,0x30,0x30,0x3a,0x30,0x30,0x20,0x47,0x4d,0x54,0x0d,
 0x0a,0x50,0x72,0x61,0x67,0x6d,0x61,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,
 0x65,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (3296 bytes) */
+/* raw file data (4082 bytes) */
 0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0d,
 0x0a,0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,0x09,0x3c,0x73,0x74,0x79,0x6c,0x65,
 0x3e,0x0d,0x0a,0x09,0x09,0x68,0x65,0x61,0x64,0x20,0x7b,0x6d,0x61,0x72,0x67,0x69,
@@ -734,105 +841,154 @@ Pragma: no-cache
 0x0d,0x0a,0x09,0x09,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,0x0d,0x0a,0x09,0x09,0x3c,
 0x66,0x6f,0x72,0x6d,0x20,0x61,0x63,0x74,0x69,0x6f,0x6e,0x3d,0x22,0x2f,0x66,0x6f,
 0x72,0x6d,0x5f,0x6f,0x70,0x65,0x72,0x61,0x74,0x69,0x6e,0x67,0x5f,0x6d,0x6f,0x64,
-0x65,0x2e,0x63,0x67,0x69,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x70,0x3e,0x0d,
-0x0a,0x09,0x09,0x09,0x09,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x66,0x6f,0x72,0x3d,
-0x22,0x6f,0x70,0x65,0x72,0x61,0x74,0x69,0x6e,0x67,0x5f,0x6d,0x6f,0x64,0x65,0x22,
-0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x75,0x3e,0x53,0x65,0x74,0x20,0x6f,0x70,0x65,0x72,
-0x61,0x74,0x69,0x6e,0x67,0x20,0x6d,0x6f,0x64,0x65,0x3c,0x2f,0x75,0x3e,0x3c,0x2f,
-0x68,0x33,0x3e,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x0d,0x0a,0x09,0x09,0x09,
-0x09,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x73,0x75,
-0x62,0x6d,0x69,0x74,0x22,0x20,0x69,0x64,0x3d,0x22,0x6f,0x70,0x65,0x72,0x61,0x74,
-0x69,0x6e,0x67,0x5f,0x6d,0x6f,0x64,0x65,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,
-0x22,0x61,0x75,0x74,0x6f,0x6d,0x61,0x74,0x69,0x63,0x22,0x20,0x6e,0x61,0x6d,0x65,
-0x3d,0x22,0x6f,0x70,0x65,0x72,0x61,0x74,0x69,0x6e,0x67,0x5f,0x6d,0x6f,0x64,0x65,
-0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,
-0x30,0x30,0x70,0x78,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x33,0x30,0x70,0x78,
-0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x32,0x30,0x70,0x78,0x3b,
-0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,
-0x79,0x70,0x65,0x3d,0x22,0x73,0x75,0x62,0x6d,0x69,0x74,0x22,0x20,0x69,0x64,0x3d,
-0x22,0x6f,0x70,0x65,0x72,0x61,0x74,0x69,0x6e,0x67,0x5f,0x6d,0x6f,0x64,0x65,0x22,
-0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x6d,0x61,0x6e,0x75,0x61,0x6c,0x22,0x20,
+0x65,0x2e,0x63,0x67,0x69,0x22,0x20,0x6f,0x6e,0x73,0x75,0x62,0x6d,0x69,0x74,0x3d,
+0x22,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x21,0x73,0x65,0x6e,0x64,0x5f,0x6d,0x6f,
+0x64,0x65,0x28,0x65,0x76,0x65,0x6e,0x74,0x2e,0x73,0x75,0x62,0x6d,0x69,0x74,0x74,
+0x65,0x72,0x2e,0x76,0x61,0x6c,0x75,0x65,0x29,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,
+0x3c,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,
+0x66,0x6f,0x72,0x3d,0x22,0x6f,0x70,0x65,0x72,0x61,0x74,0x69,0x6e,0x67,0x5f,0x6d,
+0x6f,0x64,0x65,0x22,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x75,0x3e,0x53,0x65,0x74,0x20,
+0x6f,0x70,0x65,0x72,0x61,0x74,0x69,0x6e,0x67,0x20,0x6d,0x6f,0x64,0x65,0x3c,0x2f,
+0x75,0x3e,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x0d,
+0x0a,0x09,0x09,0x09,0x09,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,
+0x3d,0x22,0x73,0x75,0x62,0x6d,0x69,0x74,0x22,0x20,0x69,0x64,0x3d,0x22,0x6f,0x70,
+0x65,0x72,0x61,0x74,0x69,0x6e,0x67,0x5f,0x6d,0x6f,0x64,0x65,0x22,0x20,0x76,0x61,
+0x6c,0x75,0x65,0x3d,0x22,0x61,0x75,0x74,0x6f,0x6d,0x61,0x74,0x69,0x63,0x22,0x20,
 0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6f,0x70,0x65,0x72,0x61,0x74,0x69,0x6e,0x67,0x5f,
 0x6d,0x6f,0x64,0x65,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,
-0x74,0x68,0x3a,0x38,0x30,0x70,0x78,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x33,
-0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x32,0x30,
-0x70,0x78,0x3b,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,
-0x09,0x09,0x09,0x3c,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x68,0x33,0x3e,
-0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x20,0x6d,0x6f,0x64,0x65,0x3a,0x3c,0x21,0x2d,
-0x2d,0x23,0x6f,0x70,0x6d,0x6f,0x64,0x2d,0x2d,0x3e,0x3c,0x2f,0x68,0x33,0x3e,0x0d,
-0x0a,0x09,0x09,0x09,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x2f,0x66,0x6f,
-0x72,0x6d,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x66,0x6f,0x72,0x6d,0x20,0x61,0x63,0x74,
-0x69,0x6f,0x6e,0x3d,0x22,0x2f,0x66,0x6f,0x72,0x6d,0x5f,0x72,0x70,0x6d,0x2e,0x63,
-0x67,0x69,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x70,0x3e,0x0d,0x0a,0x09,0x09,
-0x09,0x09,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x66,0x6f,0x72,0x3d,0x22,0x72,0x70,
-0x6d,0x22,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x75,0x3e,0x53,0x65,0x74,0x20,0x6d,0x61,
-0x78,0x20,0x72,0x70,0x6d,0x3c,0x2f,0x75,0x3e,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,
-0x6c,0x61,0x62,0x65,0x6c,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x69,0x6e,0x70,
-0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x22,0x20,0x69,
-0x64,0x3d,0x22,0x72,0x70,0x6d,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,
-0x78,0x5f,0x72,0x70,0x6d,0x22,0x20,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,
-0x65,0x72,0x3d,0x22,0x31,0x36,0x30,0x30,0x22,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
-0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x33,0x35,0x70,0x78,0x3b,0x77,0x69,0x64,0x74,
-0x68,0x3a,0x34,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,
-0x3a,0x31,0x35,0x70,0x78,0x3b,0x22,0x3e,0x20,0x55,0x2f,0x6d,0x69,0x6e,0x2e,0x3c,
-0x62,0x72,0x3e,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x69,0x6e,
-0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x73,0x75,0x62,0x6d,0x69,0x74,
-0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x73,0x65,0x74,0x20,0x72,0x70,0x6d,
-0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x73,0x65,0x74,0x5f,0x72,0x70,0x6d,0x5f,
-0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,
-0x69,0x64,0x74,0x68,0x3a,0x38,0x30,0x70,0x78,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,
-0x3a,0x33,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
-0x32,0x30,0x70,0x78,0x3b,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x2f,0x70,0x3e,
-0x0d,0x0a,0x09,0x09,0x09,0x3c,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x68,
-0x33,0x3e,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x20,0x6d,0x61,0x78,0x20,0x72,0x70,
-0x6d,0x3a,0x3c,0x21,0x2d,0x2d,0x23,0x6d,0x61,0x78,0x72,0x70,0x6d,0x2d,0x2d,0x3e,
-0x3c,0x2f,0x68,0x33,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,
-0x09,0x09,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x66,0x6f,
-0x72,0x6d,0x20,0x61,0x63,0x74,0x69,0x6f,0x6e,0x3d,0x22,0x2f,0x66,0x6f,0x72,0x6d,
-0x5f,0x64,0x65,0x6c,0x74,0x61,0x2e,0x63,0x67,0x69,0x22,0x3e,0x0d,0x0a,0x09,0x09,
-0x09,0x3c,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x6c,0x61,0x62,0x65,0x6c,
-0x20,0x66,0x6f,0x72,0x3d,0x22,0x64,0x65,0x6c,0x74,0x61,0x22,0x3e,0x3c,0x68,0x33,
-0x3e,0x3c,0x75,0x3e,0x53,0x65,0x74,0x20,0x6d,0x61,0x78,0x20,0x61,0x63,0x63,0x65,
-0x70,0x74,0x65,0x64,0x20,0x64,0x65,0x6c,0x74,0x61,0x3c,0x2f,0x75,0x3e,0x3c,0x2f,
-0x68,0x33,0x3e,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x0d,0x0a,0x09,0x09,0x09,
-0x09,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,
-0x78,0x74,0x22,0x20,0x69,0x64,0x3d,0x22,0x64,0x65,0x6c,0x74,0x61,0x22,0x20,0x6e,
-0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x78,0x5f,0x64,0x65,0x6c,0x74,0x61,0x22,0x20,
-0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x3d,0x22,0x31,0x30,0x30,
-0x22,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x33,
-0x35,0x70,0x78,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x33,0x30,0x70,0x78,0x3b,0x66,
-0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x35,0x70,0x78,0x3b,0x22,0x3e,
-0x20,0x6d,0x6d,0x3c,0x62,0x72,0x3e,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x09,0x09,0x09,
-0x09,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x73,0x75,
-0x62,0x6d,0x69,0x74,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x73,0x65,0x74,
-0x20,0x64,0x65,0x6c,0x74,0x61,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,
-0x73,0x74,0x61,0x72,0x74,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x73,0x74,
-0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x3a,0x39,0x30,0x70,0x78,0x3b,
-0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x33,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,
-0x2d,0x73,0x69,0x7a,0x65,0x3a,0x32,0x30,0x70,0x78,0x3b,0x22,0x3e,0x0d,0x0a,0x09,
-0x09,0x09,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x70,0x3e,0x0d,0x0a,
-0x09,0x09,0x09,0x09,0x3c,0x68,0x33,0x3e,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x20,
-0x6d,0x61,0x78,0x20,0x61,0x63,0x63,0x65,0x70,0x74,0x65,0x64,0x3a,0x3c,0x21,0x2d,
-0x2d,0x23,0x6d,0x61,0x78,0x64,0x65,0x6c,0x2d,0x2d,0x3e,0x3c,0x2f,0x68,0x33,0x3e,
-0x0d,0x0a,0x09,0x09,0x09,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x2f,0x66,
-0x6f,0x72,0x6d,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x66,0x6f,0x72,0x6d,0x20,0x61,0x63,
-0x74,0x69,0x6f,0x6e,0x3d,0x22,0x2f,0x66,0x6f,0x72,0x6d,0x5f,0x64,0x68,0x63,0x70,
-0x2e,0x63,0x67,0x69,0x22,0x20,0x20,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x70,0x3e,
-0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x66,0x6f,0x72,
-0x3d,0x22,0x64,0x68,0x63,0x70,0x22,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x75,0x3e,0x45,
-0x6e,0x61,0x62,0x6c,0x65,0x20,0x44,0x48,0x43,0x50,0x3c,0x2f,0x75,0x3e,0x3c,0x2f,
-0x68,0x33,0x3e,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x0d,0x0a,0x09,0x09,0x09,
-0x09,0x3c,0x21,0x2d,0x2d,0x23,0x64,0x68,0x63,0x70,0x2d,0x2d,0x3e,0x0d,0x0a,0x09,
-0x09,0x09,0x09,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,
-0x73,0x75,0x62,0x6d,0x69,0x74,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x73,
-0x75,0x62,0x6d,0x69,0x74,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x64,0x68,0x63,
-0x70,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
-0x22,0x77,0x69,0x64,0x74,0x68,0x3a,0x39,0x30,0x70,0x78,0x3b,0x68,0x65,0x69,0x67,
+0x74,0x68,0x3a,0x31,0x30,0x30,0x70,0x78,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,
+0x33,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x32,
+0x30,0x70,0x78,0x3b,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x69,0x6e,0x70,
+0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x73,0x75,0x62,0x6d,0x69,0x74,0x22,
+0x20,0x69,0x64,0x3d,0x22,0x6f,0x70,0x65,0x72,0x61,0x74,0x69,0x6e,0x67,0x5f,0x6d,
+0x6f,0x64,0x65,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x6d,0x61,0x6e,0x75,
+0x61,0x6c,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6f,0x70,0x65,0x72,0x61,0x74,
+0x69,0x6e,0x67,0x5f,0x6d,0x6f,0x64,0x65,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
+0x22,0x77,0x69,0x64,0x74,0x68,0x3a,0x38,0x30,0x70,0x78,0x3b,0x68,0x65,0x69,0x67,
 0x68,0x74,0x3a,0x33,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,
 0x65,0x3a,0x32,0x30,0x70,0x78,0x3b,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x2f,
-0x70,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,0x0d,0x0a,0x09,
-0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,
-};
+0x70,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,
+0x3c,0x68,0x33,0x3e,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x20,0x6d,0x6f,0x64,0x65,
+0x3a,0x3c,0x73,0x70,0x61,0x6e,0x20,0x69,0x64,0x3d,0x22,0x6f,0x70,0x6d,0x6f,0x64,
+0x22,0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x6f,0x70,0x6d,0x6f,0x64,0x2d,0x2d,0x3e,0x3c,
+0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x68,0x33,0x3e,0x0d,0x0a,0x09,0x09,0x09,
+0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,0x0d,
+0x0a,0x09,0x09,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x09,0x09,0x09,
+0x2f,0x2a,0x20,0x74,0x68,0x65,0x20,0x6d,0x6f,0x64,0x65,0x20,0x69,0x73,0x20,0x73,
+0x77,0x69,0x74,0x63,0x68,0x65,0x64,0x20,0x6f,0x76,0x65,0x72,0x20,0x74,0x68,0x65,
+0x20,0x57,0x65,0x62,0x53,0x6f,0x63,0x6b,0x65,0x74,0x20,0x6f,0x66,0x20,0x74,0x68,
+0x65,0x20,0x52,0x45,0x53,0x54,0x20,0x73,0x65,0x72,0x76,0x65,0x72,0x20,0x69,0x66,
+0x20,0x69,0x74,0x20,0x69,0x73,0x20,0x6f,0x70,0x65,0x6e,0x2c,0x20,0x74,0x68,0x65,
+0x20,0x66,0x6f,0x72,0x6d,0x20,0x69,0x73,0x20,0x74,0x68,0x65,0x20,0x66,0x61,0x6c,
+0x6c,0x62,0x61,0x63,0x6b,0x20,0x2a,0x2f,0x0d,0x0a,0x09,0x09,0x09,0x76,0x61,0x72,
+0x20,0x6d,0x6f,0x64,0x65,0x73,0x20,0x3d,0x20,0x5b,0x22,0x6d,0x61,0x6e,0x75,0x61,
+0x6c,0x22,0x2c,0x20,0x22,0x61,0x75,0x74,0x6f,0x6d,0x61,0x74,0x69,0x63,0x22,0x5d,
+0x3b,0x0d,0x0a,0x09,0x09,0x09,0x76,0x61,0x72,0x20,0x73,0x6f,0x63,0x6b,0x65,0x74,
+0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x57,0x65,0x62,0x53,0x6f,0x63,0x6b,0x65,0x74,
+0x28,0x22,0x77,0x73,0x3a,0x2f,0x2f,0x22,0x20,0x2b,0x20,0x6c,0x6f,0x63,0x61,0x74,
+0x69,0x6f,0x6e,0x2e,0x68,0x6f,0x73,0x74,0x6e,0x61,0x6d,0x65,0x20,0x2b,0x20,0x22,
+0x3a,0x32,0x33,0x37,0x35,0x2f,0x64,0x61,0x74,0x61,0x2f,0x77,0x73,0x22,0x29,0x3b,
+0x0d,0x0a,0x09,0x09,0x09,0x73,0x6f,0x63,0x6b,0x65,0x74,0x2e,0x6f,0x6e,0x6d,0x65,
+0x73,0x73,0x61,0x67,0x65,0x20,0x3d,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
+0x28,0x65,0x76,0x65,0x6e,0x74,0x29,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x76,
+0x61,0x72,0x20,0x73,0x74,0x61,0x74,0x65,0x20,0x3d,0x20,0x4a,0x53,0x4f,0x4e,0x2e,
+0x70,0x61,0x72,0x73,0x65,0x28,0x65,0x76,0x65,0x6e,0x74,0x2e,0x64,0x61,0x74,0x61,
+0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x22,0x6f,0x70,0x65,
+0x72,0x61,0x74,0x69,0x6e,0x67,0x5f,0x6d,0x6f,0x64,0x65,0x22,0x20,0x69,0x6e,0x20,
+0x73,0x74,0x61,0x74,0x65,0x29,0x20,0x7b,0x20,0x6f,0x70,0x6d,0x6f,0x64,0x2e,0x74,
+0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x3d,0x20,0x6d,0x6f,0x64,
+0x65,0x73,0x5b,0x73,0x74,0x61,0x74,0x65,0x2e,0x6f,0x70,0x65,0x72,0x61,0x74,0x69,
+0x6e,0x67,0x5f,0x6d,0x6f,0x64,0x65,0x5d,0x3b,0x20,0x7d,0x0d,0x0a,0x09,0x09,0x09,
+0x7d,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
+0x73,0x65,0x6e,0x64,0x5f,0x6d,0x6f,0x64,0x65,0x28,0x6d,0x6f,0x64,0x65,0x29,0x20,
+0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x73,0x6f,0x63,0x6b,0x65,
+0x74,0x2e,0x72,0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x20,0x21,0x3d,0x20,
+0x57,0x65,0x62,0x53,0x6f,0x63,0x6b,0x65,0x74,0x2e,0x4f,0x50,0x45,0x4e,0x29,0x20,
+0x7b,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x20,
+0x7d,0x0d,0x0a,0x09,0x09,0x09,0x09,0x73,0x6f,0x63,0x6b,0x65,0x74,0x2e,0x73,0x65,
+0x6e,0x64,0x28,0x27,0x7b,0x22,0x6f,0x70,0x65,0x72,0x61,0x74,0x69,0x6e,0x67,0x5f,
+0x6d,0x6f,0x64,0x65,0x22,0x3a,0x27,0x20,0x2b,0x20,0x6d,0x6f,0x64,0x65,0x73,0x2e,
+0x69,0x6e,0x64,0x65,0x78,0x4f,0x66,0x28,0x6d,0x6f,0x64,0x65,0x29,0x20,0x2b,0x20,
+0x27,0x7d,0x27,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x72,0x65,0x74,0x75,0x72,
+0x6e,0x20,0x74,0x72,0x75,0x65,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,
+0x09,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x66,
+0x6f,0x72,0x6d,0x20,0x61,0x63,0x74,0x69,0x6f,0x6e,0x3d,0x22,0x2f,0x66,0x6f,0x72,
+0x6d,0x5f,0x72,0x70,0x6d,0x2e,0x63,0x67,0x69,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,
+0x3c,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,
+0x66,0x6f,0x72,0x3d,0x22,0x72,0x70,0x6d,0x22,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x75,
+0x3e,0x53,0x65,0x74,0x20,0x6d,0x61,0x78,0x20,0x72,0x70,0x6d,0x3c,0x2f,0x75,0x3e,
+0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x0d,0x0a,0x09,
+0x09,0x09,0x09,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,
+0x74,0x65,0x78,0x74,0x22,0x20,0x69,0x64,0x3d,0x22,0x72,0x70,0x6d,0x22,0x20,0x6e,
+0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x78,0x5f,0x72,0x70,0x6d,0x22,0x20,0x70,0x6c,
+0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x3d,0x22,0x31,0x36,0x30,0x30,0x22,
+0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x33,0x35,
+0x70,0x78,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x30,0x70,0x78,0x3b,0x66,0x6f,
+0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x35,0x70,0x78,0x3b,0x22,0x3e,0x20,
+0x55,0x2f,0x6d,0x69,0x6e,0x2e,0x3c,0x62,0x72,0x3e,0x3c,0x62,0x72,0x3e,0x0d,0x0a,
+0x09,0x09,0x09,0x09,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,
+0x22,0x73,0x75,0x62,0x6d,0x69,0x74,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,
+0x73,0x65,0x74,0x20,0x72,0x70,0x6d,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x73,
+0x65,0x74,0x5f,0x72,0x70,0x6d,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x3a,0x38,0x30,0x70,0x78,
+0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x33,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,
+0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x32,0x30,0x70,0x78,0x3b,0x22,0x3e,0x0d,0x0a,
+0x09,0x09,0x09,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x70,0x3e,0x0d,
+0x0a,0x09,0x09,0x09,0x09,0x3c,0x68,0x33,0x3e,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,
+0x20,0x6d,0x61,0x78,0x20,0x72,0x70,0x6d,0x3a,0x3c,0x21,0x2d,0x2d,0x23,0x6d,0x61,
+0x78,0x72,0x70,0x6d,0x2d,0x2d,0x3e,0x3c,0x2f,0x68,0x33,0x3e,0x0d,0x0a,0x09,0x09,
+0x09,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,
+0x0d,0x0a,0x09,0x09,0x3c,0x66,0x6f,0x72,0x6d,0x20,0x61,0x63,0x74,0x69,0x6f,0x6e,
+0x3d,0x22,0x2f,0x66,0x6f,0x72,0x6d,0x5f,0x64,0x65,0x6c,0x74,0x61,0x2e,0x63,0x67,
+0x69,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x09,
+0x09,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x66,0x6f,0x72,0x3d,0x22,0x64,0x65,0x6c,
+0x74,0x61,0x22,0x3e,0x3c,0x68,0x33,0x3e,0x3c,0x75,0x3e,0x53,0x65,0x74,0x20,0x6d,
+0x61,0x78,0x20,0x61,0x63,0x63,0x65,0x70,0x74,0x65,0x64,0x20,0x64,0x65,0x6c,0x74,
+0x61,0x3c,0x2f,0x75,0x3e,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x6c,0x61,0x62,0x65,
+0x6c,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,
+0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x22,0x20,0x69,0x64,0x3d,0x22,0x64,
+0x65,0x6c,0x74,0x61,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x78,0x5f,
+0x64,0x65,0x6c,0x74,0x61,0x22,0x20,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,
+0x65,0x72,0x3d,0x22,0x31,0x30,0x30,0x22,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x68,
+0x65,0x69,0x67,0x68,0x74,0x3a,0x33,0x35,0x70,0x78,0x3b,0x77,0x69,0x64,0x74,0x68,
+0x3a,0x33,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
+0x31,0x35,0x70,0x78,0x3b,0x22,0x3e,0x20,0x6d,0x6d,0x3c,0x62,0x72,0x3e,0x3c,0x62,
+0x72,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,
+0x79,0x70,0x65,0x3d,0x22,0x73,0x75,0x62,0x6d,0x69,0x74,0x22,0x20,0x76,0x61,0x6c,
+0x75,0x65,0x3d,0x22,0x73,0x65,0x74,0x20,0x64,0x65,0x6c,0x74,0x61,0x22,0x20,0x6e,
+0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x73,0x74,0x61,0x72,0x74,0x5f,0x62,0x75,0x74,
+0x74,0x6f,0x6e,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,
+0x68,0x3a,0x39,0x30,0x70,0x78,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x33,0x30,
+0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x32,0x30,0x70,
+0x78,0x3b,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x09,
+0x09,0x09,0x3c,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x68,0x33,0x3e,0x63,
+0x75,0x72,0x72,0x65,0x6e,0x74,0x20,0x6d,0x61,0x78,0x20,0x61,0x63,0x63,0x65,0x70,
+0x74,0x65,0x64,0x3a,0x3c,0x21,0x2d,0x2d,0x23,0x6d,0x61,0x78,0x64,0x65,0x6c,0x2d,
+0x2d,0x3e,0x3c,0x2f,0x68,0x33,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x2f,0x70,0x3e,
+0x0d,0x0a,0x09,0x09,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,0x0d,0x0a,0x09,0x09,0x3c,
+0x66,0x6f,0x72,0x6d,0x20,0x61,0x63,0x74,0x69,0x6f,0x6e,0x3d,0x22,0x2f,0x66,0x6f,
+0x72,0x6d,0x5f,0x64,0x68,0x63,0x70,0x2e,0x63,0x67,0x69,0x22,0x20,0x20,0x3e,0x0d,
+0x0a,0x09,0x09,0x09,0x3c,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x6c,0x61,
+0x62,0x65,0x6c,0x20,0x66,0x6f,0x72,0x3d,0x22,0x64,0x68,0x63,0x70,0x22,0x3e,0x3c,
+0x68,0x33,0x3e,0x3c,0x75,0x3e,0x45,0x6e,0x61,0x62,0x6c,0x65,0x20,0x44,0x48,0x43,
+0x50,0x3c,0x2f,0x75,0x3e,0x3c,0x2f,0x68,0x33,0x3e,0x3c,0x2f,0x6c,0x61,0x62,0x65,
+0x6c,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,
+0x79,0x70,0x65,0x3d,0x22,0x63,0x68,0x65,0x63,0x6b,0x62,0x6f,0x78,0x22,0x20,0x6e,
+0x61,0x6d,0x65,0x3d,0x22,0x64,0x68,0x63,0x70,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,
+0x3d,0x22,0x74,0x72,0x75,0x65,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x68,
+0x65,0x69,0x67,0x68,0x74,0x3a,0x33,0x35,0x70,0x78,0x3b,0x77,0x69,0x64,0x74,0x68,
+0x3a,0x33,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
+0x31,0x35,0x70,0x78,0x3b,0x22,0x3e,0x3c,0x62,0x72,0x3e,0x3c,0x62,0x72,0x3e,0x0d,
+0x0a,0x09,0x09,0x09,0x09,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,
+0x3d,0x22,0x73,0x75,0x62,0x6d,0x69,0x74,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,
+0x22,0x73,0x75,0x62,0x6d,0x69,0x74,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x64,
+0x68,0x63,0x70,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x73,0x74,0x79,0x6c,
+0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x3a,0x39,0x30,0x70,0x78,0x3b,0x68,0x65,
+0x69,0x67,0x68,0x74,0x3a,0x33,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,
+0x69,0x7a,0x65,0x3a,0x32,0x30,0x70,0x78,0x3b,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,
+0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,0x0d,
+0x0a,0x09,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x68,0x74,0x6d,
+0x6c,0x3e,};
 
 
 
@@ -0,0 +1,240 @@
+/**
+ * \file Binary_Protocol.c
+ * @date 17 Oct 2026
+ * @brief Fixed layout binary frames to read the state and to set sail position, mode and error
+ */
+#include <string.h>
+#include "Binary_Protocol.h"
+#include "Telemetry.h"
+#include "Linear_Guide.h"
+#include "Command.h"
+
+/* defines -----------------------------------------------------------*/
+#define BINARY_PROTOCOL_CRC_POLYNOMIAL  0x1021U
+#define BINARY_PROTOCOL_CRC_INIT        0xFFFFU
+#define BINARY_PROTOCOL_MAX_SAIL_POS    100
+
+/* private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief write the state payload of the latest telemetry snapshot
+ * @param response_ptr: ptr to the response
+ * @retval none
+ */
+static void Binary_Protocol_create_state(Binary_Protocol_frame_t *response_ptr);
+
+/**
+ * @brief get the flags of the state and telemetry payloads
+ * @param snapshot_ptr: ptr to the telemetry snapshot
+ * @retval BINARY_PROTOCOL_FLAG_x
+ */
+static uint8_t Binary_Protocol_get_flags(const Telemetry_snapshot_t *snapshot_ptr);
+
+/**
+ * @brief saturate the wind speed to 16 bit
+ * @param snapshot_ptr: ptr to the telemetry snapshot
+ * @retval wind speed in 0.01 unit
+ */
+static uint16_t Binary_Protocol_get_wind_speed(const Telemetry_snapshot_t *snapshot_ptr);
+
+/**
+ * @brief check a set command and queue it for the control task
+ * @param command: BINARY_PROTOCOL_SET_x
+ * @param value: payload byte of the request
+ * @retval BINARY_PROTOCOL_OK, _INVALID_VALUE, _DENIED or _BUSY
+ */
+static uint8_t Binary_Protocol_set(uint8_t command, uint8_t value);
+
+static void Binary_Protocol_put_u16(uint8_t *buffer, uint16_t value);
+
+static void Binary_Protocol_put_u32(uint8_t *buffer, uint32_t value);
+
+/* API function definitions -----------------------------------------------*/
+
+uint16_t Binary_Protocol_crc16(const uint8_t *data, size_t length) {
+  uint16_t crc = BINARY_PROTOCOL_CRC_INIT;
+
+  for (size_t i = 0U; i < length; i++) {
+    crc ^= (uint16_t) data[i] << 8;
+    for (uint8_t bit = 0U; bit < 8U; bit++) {
+      crc = (crc & 0x8000U) ? (uint16_t) ((crc << 1) ^ BINARY_PROTOCOL_CRC_POLYNOMIAL) : (uint16_t) (crc << 1);
+    }
+  }
+  return crc;
+}
+
+size_t Binary_Protocol_encode(const Binary_Protocol_frame_t *frame_ptr, uint8_t *buffer, size_t size) {
+  size_t length = BINARY_PROTOCOL_HEADER_SIZE + frame_ptr->length;
+
+  if (frame_ptr->length > BINARY_PROTOCOL_MAX_PAYLOAD || size < length + BINARY_PROTOCOL_CRC_SIZE) {
+    return 0U;
+  }
+  buffer[0] = BINARY_PROTOCOL_START;
+  buffer[1] = frame_ptr->command;
+  buffer[2] = frame_ptr->sequence;
+  buffer[3] = frame_ptr->length;
+  memcpy(&buffer[BINARY_PROTOCOL_HEADER_SIZE], frame_ptr->payload, frame_ptr->length);
+  Binary_Protocol_put_u16(&buffer[length], Binary_Protocol_crc16(buffer, length));
+  return length + BINARY_PROTOCOL_CRC_SIZE;
+}
+
+int8_t Binary_Protocol_decode(const uint8_t *buffer, size_t length, Binary_Protocol_frame_t *frame_ptr,
+                              size_t *consumed_ptr) {
+  size_t frame_length;
+  uint16_t crc;
+
+  *consumed_ptr = 0U;
+  /* skip everything in front of the next start byte */
+  while (*consumed_ptr < length && buffer[*consumed_ptr] != BINARY_PROTOCOL_START) {
+    (*consumed_ptr)++;
+  }
+  if (*consumed_ptr > 0U || length < BINARY_PROTOCOL_HEADER_SIZE) {
+    return BINARY_PROTOCOL_FRAME_INCOMPLETE;
+  }
+  if (buffer[3] > BINARY_PROTOCOL_MAX_PAYLOAD) {
+    /* the start byte was not the begin of a frame, resynchronize at the next one */
+    *consumed_ptr = 1U;
+    return BINARY_PROTOCOL_FRAME_INVALID;
+  }
+  frame_length = BINARY_PROTOCOL_HEADER_SIZE + buffer[3];
+  if (length < frame_length + BINARY_PROTOCOL_CRC_SIZE) {
+    return BINARY_PROTOCOL_FRAME_INCOMPLETE;
+  }
+  crc = (uint16_t) (buffer[frame_length] | ((uint16_t) buffer[frame_length + 1U] << 8));
+  if (crc != Binary_Protocol_crc16(buffer, frame_length)) {
+    *consumed_ptr = 1U;
+    return BINARY_PROTOCOL_FRAME_INVALID;
+  }
+  frame_ptr->command = buffer[1];
+  frame_ptr->sequence = buffer[2];
+  frame_ptr->length = buffer[3];
+  memcpy(frame_ptr->payload, &buffer[BINARY_PROTOCOL_HEADER_SIZE], frame_ptr->length);
+  *consumed_ptr = frame_length + BINARY_PROTOCOL_CRC_SIZE;
+  return BINARY_PROTOCOL_FRAME_COMPLETE;
+}
+
+void Binary_Protocol_handle(const Binary_Protocol_frame_t *request_ptr, Binary_Protocol_frame_t *response_ptr) {
+  response_ptr->command = request_ptr->command | BINARY_PROTOCOL_RESPONSE_FLAG;
+  response_ptr->sequence = request_ptr->sequence;
+  response_ptr->length = 1U;
+
+  switch (request_ptr->command) {
+    case BINARY_PROTOCOL_GET_STATE:
+      Binary_Protocol_create_state(response_ptr);
+      break;
+    case BINARY_PROTOCOL_SET_SAIL_POS:
+    case BINARY_PROTOCOL_SET_MODE:
+    case BINARY_PROTOCOL_SET_ERROR:
+      response_ptr->payload[0] = (request_ptr->length == 1U) ?
+          Binary_Protocol_set(request_ptr->command, request_ptr->payload[0]) : BINARY_PROTOCOL_INVALID_VALUE;
+      break;
+    default:
+      response_ptr->payload[0] = BINARY_PROTOCOL_UNKNOWN_COMMAND;
+      break;
+  }
+}
+
+void Binary_Protocol_create_telemetry(Binary_Protocol_frame_t *frame_ptr, uint32_t sequence) {
+  Telemetry_snapshot_t snapshot;
+  uint8_t *payload = frame_ptr->payload;
+
+  Telemetry_get_snapshot(&snapshot);
+  frame_ptr->command = BINARY_PROTOCOL_TELEMETRY;
+  frame_ptr->sequence = (uint8_t) sequence;
+  frame_ptr->length = BINARY_PROTOCOL_TELEMETRY_SIZE;
+  Binary_Protocol_put_u32(&payload[0], sequence);
+  Binary_Protocol_put_u32(&payload[4], snapshot.timestamp_ms);
+  Binary_Protocol_put_u16(&payload[8], (uint16_t) snapshot.current_pos_mm);
+  Binary_Protocol_put_u16(&payload[10], (uint16_t) snapshot.desired_pos_mm);
+  Binary_Protocol_put_u16(&payload[12], snapshot.rpm_set_point);
+  Binary_Protocol_put_u16(&payload[14], snapshot.current_mA);
+  Binary_Protocol_put_u16(&payload[16], Binary_Protocol_get_wind_speed(&snapshot));
+  Binary_Protocol_put_u16(&payload[18], snapshot.wind_sample.direction_x10);
+  payload[20] = (uint8_t) snapshot.error_state;
+  payload[21] = (uint8_t) snapshot.operating_mode;
+  payload[22] = Binary_Protocol_get_flags(&snapshot);
+}
+
+void Binary_Protocol_create_crc_error(Binary_Protocol_frame_t *response_ptr) {
+  /* command and sequence of a corrupted frame are unknown */
+  response_ptr->command = BINARY_PROTOCOL_RESPONSE_FLAG;
+  response_ptr->sequence = 0U;
+  response_ptr->length = 1U;
+  response_ptr->payload[0] = BINARY_PROTOCOL_CRC_ERROR;
+}
+
+/* private function definitions -----------------------------------------------*/
+
+static void Binary_Protocol_create_state(Binary_Protocol_frame_t *response_ptr) {
+  Telemetry_snapshot_t snapshot;
+  uint8_t *payload = response_ptr->payload;
+
+  Telemetry_get_snapshot(&snapshot);
+
+  Binary_Protocol_put_u32(&payload[0], snapshot.sequence);
+  Binary_Protocol_put_u16(&payload[4], (uint16_t) snapshot.current_pos_mm);
+  Binary_Protocol_put_u16(&payload[6], (uint16_t) snapshot.measured_pos_mm);
+  Binary_Protocol_put_u16(&payload[8], snapshot.current_mA);
+  Binary_Protocol_put_u16(&payload[10], Binary_Protocol_get_wind_speed(&snapshot));
+  Binary_Protocol_put_u16(&payload[12], snapshot.wind_sample.direction_x10);
+  payload[14] = (uint8_t) snapshot.roll_pitch_percentage;
+  payload[15] = (uint8_t) snapshot.error_state;
+  payload[16] = (uint8_t) snapshot.operating_mode;
+  payload[17] = (uint8_t) snapshot.movement;
+  payload[18] = Binary_Protocol_get_flags(&snapshot);
+  response_ptr->length = BINARY_PROTOCOL_STATE_SIZE;
+}
+
+static uint8_t Binary_Protocol_get_flags(const Telemetry_snapshot_t *snapshot_ptr) {
+  uint8_t flags = 0U;
+
+  flags |= (snapshot_ptr->is_localized == True) ? BINARY_PROTOCOL_FLAG_LOCALIZED : 0U;
+  flags |= (snapshot_ptr->is_front_endswitch_detected == True) ? BINARY_PROTOCOL_FLAG_FRONT : 0U;
+  flags |= (snapshot_ptr->is_back_endswitch_detected == True) ? BINARY_PROTOCOL_FLAG_BACK : 0U;
+  return flags;
+}
+
+static uint16_t Binary_Protocol_get_wind_speed(const Telemetry_snapshot_t *snapshot_ptr) {
+  return (snapshot_ptr->wind_sample.speed_x100 > UINT16_MAX) ? UINT16_MAX : (uint16_t) snapshot_ptr->wind_sample.speed_x100;
+}
+
+static uint8_t Binary_Protocol_set(uint8_t command, uint8_t value) {
+  int8_t sail_pos = (int8_t) value;
+  int8_t result;
+
+  /* same value ranges as the REST validators */
+  switch (command) {
+    case BINARY_PROTOCOL_SET_SAIL_POS:
+      if (sail_pos < -BINARY_PROTOCOL_MAX_SAIL_POS || sail_pos > BINARY_PROTOCOL_MAX_SAIL_POS) {
+        return BINARY_PROTOCOL_INVALID_VALUE;
+      }
+      result = Command_post(Command_set_sail_pos, sail_pos);
+      break;
+    case BINARY_PROTOCOL_SET_MODE:
+      if (value != LG_operating_mode_manual && value != LG_operating_mode_automatic) {
+        return BINARY_PROTOCOL_INVALID_VALUE;
+      }
+      result = Command_post(Command_set_operating_mode, value);
+      break;
+    default:
+      if (value != LG_error_state_0_normal && value != LG_error_state_2_wind_speed_fault) {
+        return BINARY_PROTOCOL_INVALID_VALUE;
+      }
+      result = Command_post(Command_set_error, value);
+      break;
+  }
+  if (result == COMMAND_DENIED) {
+    return BINARY_PROTOCOL_DENIED;
+  }
+  return (result == COMMAND_QUEUE_FULL) ? BINARY_PROTOCOL_BUSY : BINARY_PROTOCOL_OK;
+}
+
+static void Binary_Protocol_put_u16(uint8_t *buffer, uint16_t value) {
+  buffer[0] = (uint8_t) value;
+  buffer[1] = (uint8_t) (value >> 8);
+}
+
+static void Binary_Protocol_put_u32(uint8_t *buffer, uint32_t value) {
+  Binary_Protocol_put_u16(&buffer[0], (uint16_t) value);
+  Binary_Protocol_put_u16(&buffer[2], (uint16_t) (value >> 16));
+}
@@ -0,0 +1,156 @@
+/**
+ * \file Binary_Protocol.h
+ * @date 17 Oct 2026
+ * @brief Fixed layout binary frames to read the state and to set sail position, mode and error
+ *
+ * Frame layout, multi byte values are little endian:
+ *   [0]      BINARY_PROTOCOL_START
+ *   [1]      command, the response sets BINARY_PROTOCOL_RESPONSE_FLAG
+ *   [2]      sequence number, echoed by the response
+ *   [3]      payload length n (0 ... BINARY_PROTOCOL_MAX_PAYLOAD)
+ *   [4]      payload
+ *   [4 + n]  CRC-16/CCITT-FALSE of bytes 0 ... 3 + n
+ * Testprotocol/BinaryProtocol.py is the host side reference of the frame format.
+ */
+
+#ifndef BINARY_PROTOCOL_BINARY_PROTOCOL_H_
+#define BINARY_PROTOCOL_BINARY_PROTOCOL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* defines -----------------------------------------------------------*/
+#define BINARY_PROTOCOL_START           0x5AU
+#define BINARY_PROTOCOL_RESPONSE_FLAG   0x80U
+#define BINARY_PROTOCOL_HEADER_SIZE     4U
+#define BINARY_PROTOCOL_CRC_SIZE        2U
+#define BINARY_PROTOCOL_MAX_PAYLOAD     32U
+#define BINARY_PROTOCOL_MAX_FRAME_SIZE  (BINARY_PROTOCOL_HEADER_SIZE + BINARY_PROTOCOL_MAX_PAYLOAD + BINARY_PROTOCOL_CRC_SIZE)
+
+/* commands */
+#define BINARY_PROTOCOL_GET_STATE       0x01U  /* response: state payload, see below */
+#define BINARY_PROTOCOL_SET_SAIL_POS    0x02U  /* int8_t -100 ... 100 */
+#define BINARY_PROTOCOL_SET_MODE        0x03U  /* uint8_t LG_operating_mode_t */
+#define BINARY_PROTOCOL_SET_ERROR       0x04U  /* uint8_t 0: normal, 2: wind speed fault */
+#define BINARY_PROTOCOL_TELEMETRY       0x10U  /* published without request, telemetry payload, see below */
+
+/* status, single payload byte of the set responses and of error responses */
+#define BINARY_PROTOCOL_OK              0U
+#define BINARY_PROTOCOL_INVALID_VALUE   1U
+#define BINARY_PROTOCOL_UNKNOWN_COMMAND 2U
+#define BINARY_PROTOCOL_CRC_ERROR       3U
+#define BINARY_PROTOCOL_DENIED          4U  /* the linear guide refused the mode switch */
+#define BINARY_PROTOCOL_BUSY            5U  /* the command queue of the control task is full */
+
+/* payload of the GET_STATE response:
+ *   [0]  uint32_t sequence of the telemetry snapshot
+ *   [4]  int16_t  current position in mm
+ *   [6]  int16_t  position of the distance sensor in mm
+ *   [8]  uint16_t motor current in mA
+ *   [10] uint16_t wind speed in 0.01 unit
+ *   [12] uint16_t wind direction in 0.1 degree
+ *   [14] int8_t   sail position in percent
+ *   [15] uint8_t  error state
+ *   [16] uint8_t  operating mode
+ *   [17] uint8_t  movement (0: stop, 1: backwards, 2: forward)
+ *   [18] uint8_t  flags */
+#define BINARY_PROTOCOL_STATE_SIZE      19U
+#define BINARY_PROTOCOL_FLAG_LOCALIZED  0x01U
+#define BINARY_PROTOCOL_FLAG_FRONT      0x02U  /* front endswitch detected */
+#define BINARY_PROTOCOL_FLAG_BACK       0x04U  /* back endswitch detected */
+
+/* payload of the TELEMETRY datagram:
+ *   [0]  uint32_t sequence of the datagram
+ *   [4]  uint32_t timestamp of the telemetry snapshot in ms
+ *   [8]  int16_t  current position in mm
+ *   [10] int16_t  desired position in mm
+ *   [12] uint16_t rpm set point
+ *   [14] uint16_t motor current in mA
+ *   [16] uint16_t wind speed in 0.01 unit
+ *   [18] uint16_t wind direction in 0.1 degree
+ *   [20] uint8_t  error state
+ *   [21] uint8_t  operating mode
+ *   [22] uint8_t  flags */
+#define BINARY_PROTOCOL_TELEMETRY_SIZE  23U
+
+/* result of Binary_Protocol_decode */
+#define BINARY_PROTOCOL_FRAME_COMPLETE    0
+#define BINARY_PROTOCOL_FRAME_INCOMPLETE  1
+#define BINARY_PROTOCOL_FRAME_INVALID     2
+
+/* typedefs -----------------------------------------------------------*/
+
+/** @struct Binary_Protocol_frame_t
+ *  @brief decoded frame
+ *  @var Binary_Protocol_frame_t::command
+ *  command, with BINARY_PROTOCOL_RESPONSE_FLAG for responses
+ *  @var Binary_Protocol_frame_t::sequence
+ *  sequence number chosen by the client
+ *  @var Binary_Protocol_frame_t::length
+ *  number of valid payload bytes
+ *  @var Binary_Protocol_frame_t::payload
+ *  payload, little endian
+ */
+typedef struct {
+  uint8_t command;
+  uint8_t sequence;
+  uint8_t length;
+  uint8_t payload[BINARY_PROTOCOL_MAX_PAYLOAD];
+} Binary_Protocol_frame_t;
+
+/* API function prototypes -----------------------------------------------*/
+
+/**
+ * @brief calculate the CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF)
+ * @param data: ptr to the data
+ * @param length: number of bytes
+ * @retval crc
+ */
+uint16_t Binary_Protocol_crc16(const uint8_t *data, size_t length);
+
+/**
+ * @brief write a frame into a buffer
+ * @param frame_ptr: ptr to the frame
+ * @param buffer: destination
+ * @param size: size of the destination
+ * @retval length of the encoded frame, 0 if it does not fit
+ */
+size_t Binary_Protocol_encode(const Binary_Protocol_frame_t *frame_ptr, uint8_t *buffer, size_t size);
+
+/**
+ * @brief read the first frame of a buffer
+ * @param buffer: received bytes
+ * @param length: number of received bytes
+ * @param frame_ptr: destination of a complete frame
+ * @param consumed_ptr: number of bytes to drop from the buffer (frame or garbage up to the next start byte)
+ * @retval BINARY_PROTOCOL_FRAME_COMPLETE,
+ *         _INCOMPLETE (wait for more bytes, or drop the bytes before the next start byte if consumed is not 0)
+ *         or _INVALID (wrong CRC or length, answer with Binary_Protocol_create_crc_error)
+ */
+int8_t Binary_Protocol_decode(const uint8_t *buffer, size_t length, Binary_Protocol_frame_t *frame_ptr,
+                              size_t *consumed_ptr);
+
+/**
+ * @brief execute a request and build its response
+ * @param request_ptr: ptr to the decoded request
+ * @param response_ptr: ptr to the response
+ * @retval none
+ */
+void Binary_Protocol_handle(const Binary_Protocol_frame_t *request_ptr, Binary_Protocol_frame_t *response_ptr);
+
+/**
+ * @brief build a TELEMETRY frame of the latest telemetry snapshot
+ * @param frame_ptr: ptr to the frame
+ * @param sequence: sequence number of the datagram, its low byte is also the frame sequence
+ * @retval none
+ */
+void Binary_Protocol_create_telemetry(Binary_Protocol_frame_t *frame_ptr, uint32_t sequence);
+
+/**
+ * @brief build the error response of a frame with wrong CRC or length
+ * @param response_ptr: ptr to the response
+ * @retval none
+ */
+void Binary_Protocol_create_crc_error(Binary_Protocol_frame_t *response_ptr);
+
+#endif /* BINARY_PROTOCOL_BINARY_PROTOCOL_H_ */
@@ -0,0 +1,107 @@
+/**
+ * \file Command.c
+ * @date 17 Oct 2026
+ * @brief Queue of the changes the network interfaces request from the linear guide
+ */
+#include "Command.h"
+#include "FRAM.h"
+#include "FRAM_memory_mapping.h"
+
+/* defines -----------------------------------------------------------*/
+#define COMMAND_QUEUE_MASK  (COMMAND_QUEUE_SIZE - 1U)
+
+/* private global variables -----------------------------------------------*/
+static Command_t Command_queue[COMMAND_QUEUE_SIZE];
+static volatile uint8_t Command_head = 0U;   /* written by the producer only */
+static volatile uint8_t Command_tail = 0U;   /* written by the consumer only */
+static uint8_t Command_staged_head = 0U;     /* end of the uncommitted group */
+
+/* private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief execute one command
+ * @param lg_ptr: ptr to the linear guide
+ * @param command_ptr: ptr to the command
+ * @retval none
+ */
+static void Command_execute(Linear_Guide_t *lg_ptr, const Command_t *command_ptr);
+
+/* API function definitions -----------------------------------------------*/
+
+int8_t Command_post(Command_type_t type, int16_t value) {
+  int8_t result;
+
+  Command_begin();
+  result = Command_add(type, value);
+  if (result == COMMAND_OK) {
+    Command_commit();
+  }
+  return result;
+}
+
+void Command_begin(void) {
+  Command_staged_head = Command_head;
+}
+
+int8_t Command_add(Command_type_t type, int16_t value) {
+  uint8_t head = Command_staged_head;
+
+  /* checked here so the servers can answer at once, localization is not lost once reached */
+  if (type == Command_set_operating_mode && LG_get_Linear_Guide()->localization.is_localized == False) {
+    return COMMAND_DENIED;
+  }
+  if ((uint8_t) (head - Command_tail) >= COMMAND_QUEUE_SIZE) {
+    return COMMAND_QUEUE_FULL;
+  }
+  Command_queue[head & COMMAND_QUEUE_MASK].type = type;
+  Command_queue[head & COMMAND_QUEUE_MASK].value = value;
+  Command_staged_head = head + 1U;
+  return COMMAND_OK;
+}
+
+void Command_commit(void) {
+  /* the commands are complete before the consumer sees the new head */
+  __DMB();
+  Command_head = Command_staged_head;
+}
+
+void Command_process(Linear_Guide_t *lg_ptr) {
+  uint8_t tail = Command_tail;
+
+  while (tail != Command_head) {
+    __DMB();
+    Command_execute(lg_ptr, &Command_queue[tail & COMMAND_QUEUE_MASK]);
+    tail++;
+    Command_tail = tail;
+  }
+}
+
+/* private function definitions -----------------------------------------------*/
+
+static void Command_execute(Linear_Guide_t *lg_ptr, const Command_t *command_ptr) {
+  switch (command_ptr->type) {
+    case Command_set_error:
+      Linear_Guide_set_error((LG_error_state_t) command_ptr->value);
+      break;
+    case Command_set_operating_mode:
+      Linear_Guide_set_operating_mode(lg_ptr, (LG_operating_mode_t) command_ptr->value);
+      break;
+    case Command_set_sail_pos:
+      Linear_Guide_set_desired_roll_pitch_percentage(lg_ptr, (int8_t) command_ptr->value);
+      break;
+    case Command_manual_move:
+      Linear_Guide_manual_move(lg_ptr, (Loc_movement_t) command_ptr->value);
+      break;
+    case Command_set_center:
+      Linear_Guide_set_center(lg_ptr);
+      break;
+    case Command_set_max_rpm:
+      Linear_Guide_change_speed_rpm(lg_ptr, (uint16_t) command_ptr->value);
+      FRAM_write((uint8_t*) &lg_ptr->motor.normal_rpm, FRAM_MAX_RPM, sizeof(lg_ptr->motor.normal_rpm));
+      break;
+    case Command_set_max_distance_error:
+      lg_ptr->max_distance_fault = (uint8_t) command_ptr->value;
+      FRAM_write(&lg_ptr->max_distance_fault, FRAM_MAX_DELTA, 1U);
+      break;
+  }
+}
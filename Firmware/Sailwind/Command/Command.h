@@ -0,0 +1,89 @@
+/**
+ * \file Command.h
+ * @date 17 Oct 2026
+ * @brief Queue of the changes the network interfaces request from the linear guide
+ *
+ * The control task runs in the scheduler tick interrupt and preempts the main loop at any
+ * point, so the servers do not change the linear guide themselves. They validate a request,
+ * post a command and the control task executes it at the start of its next cycle.
+ * Several commands of one request are added between Command_begin and Command_commit, they
+ * become visible to the control task together, so it executes all of them in the same cycle or
+ * none if one could not be added.
+ * Single producer (main loop) and single consumer (control task), no locking is needed.
+ */
+
+#ifndef COMMAND_COMMAND_H_
+#define COMMAND_COMMAND_H_
+
+#include <stdint.h>
+#include "Linear_Guide.h"
+
+/* defines -----------------------------------------------------------*/
+#define COMMAND_QUEUE_SIZE  16U   /* power of two */
+#define COMMAND_OK          0
+#define COMMAND_QUEUE_FULL  -1
+#define COMMAND_DENIED      -2    /* not localized, the operating mode cannot be switched */
+
+/* typedefs -----------------------------------------------------------*/
+typedef enum {
+  Command_set_error,                /* LG_error_state_t */
+  Command_set_operating_mode,       /* LG_operating_mode_t */
+  Command_set_sail_pos,             /* roll / pitch percentage -100 ... 100 */
+  Command_manual_move,              /* Loc_movement_t */
+  Command_set_center,
+  Command_set_max_rpm,              /* stored in FRAM */
+  Command_set_max_distance_error    /* mm, stored in FRAM */
+} Command_type_t;
+
+/** @struct Command_t
+ *  @brief queued change
+ *  @var Command_t::type
+ *  what is changed
+ *  @var Command_t::value
+ *  new value, already validated by the server
+ */
+typedef struct {
+  Command_type_t type;
+  int16_t value;
+} Command_t;
+
+/* API function prototypes -----------------------------------------------*/
+
+/**
+ * @brief queue a single command (to be called in the main loop)
+ * @param type: what is changed
+ * @param value: new value, unused by Command_set_center
+ * @retval COMMAND_OK, COMMAND_QUEUE_FULL or COMMAND_DENIED
+ */
+int8_t Command_post(Command_type_t type, int16_t value);
+
+/**
+ * @brief start a group of commands, an uncommitted group is discarded (to be called in the main loop)
+ * @param none
+ * @retval none
+ */
+void Command_begin(void);
+
+/**
+ * @brief add a command to the group, it is not visible to the control task before Command_commit
+ * @param type: what is changed
+ * @param value: new value, unused by Command_set_center
+ * @retval COMMAND_OK, COMMAND_QUEUE_FULL or COMMAND_DENIED, the group must not be committed after an error
+ */
+int8_t Command_add(Command_type_t type, int16_t value);
+
+/**
+ * @brief hand all commands of the group to the control task at once
+ * @param none
+ * @retval none
+ */
+void Command_commit(void);
+
+/**
+ * @brief execute the queued commands (to be called by the control task before Linear_Guide_update)
+ * @param lg_ptr: ptr to the linear guide
+ * @retval none
+ */
+void Command_process(Linear_Guide_t *lg_ptr);
+
+#endif /* COMMAND_COMMAND_H_ */
@@ -10,6 +10,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "main.h"
+#include "Scheduler.h"
 
 #define WRSR 1
 #define WRITE 2
@@ -35,8 +36,45 @@ static uint8_t FRAM_read_status_register(void);
  */
 static uint8_t FRAM_write_enable(void);
 
+/**
+ * @brief write to FRAM, the caller holds the bus
+ * @param pStructToSave: pointer to structer that should be saved
+ * @param startAddress: address where struct is saved to
+ * @param sizeInByte: size of struct to be saved
+ * @retval FRAM status
+ */
+static uint8_t FRAM_write_locked(uint8_t *pStructToSave, const uint16_t startAddress,
+                                 uint16_t sizeInByte);
+
+/**
+ * @brief read from FRAM, the caller holds the bus
+ * @param startAddress: address where data is read from
+ * @param pData: pointer to buffer where read data is saved to
+ * @param sizeInByte: size of data to be read
+ * @retval FRAM status
+ */
+static uint8_t FRAM_read_locked(uint16_t startAddress, uint8_t *pData, uint16_t sizeInByte);
+
 uint8_t FRAM_write(uint8_t *pStructToSave, const uint16_t startAddress,
                    uint16_t sizeInByte) {
+  /* the control task saves the position from the tick interrupt, it must not cut into a transfer */
+  uint32_t lock = Scheduler_lock();
+  uint8_t status = FRAM_write_locked(pStructToSave, startAddress, sizeInByte);
+
+  Scheduler_unlock(lock);
+  return status;
+}
+
+uint8_t FRAM_read(uint16_t startAddress, uint8_t *pData, uint16_t sizeInByte) {
+  uint32_t lock = Scheduler_lock();
+  uint8_t status = FRAM_read_locked(startAddress, pData, sizeInByte);
+
+  Scheduler_unlock(lock);
+  return status;
+}
+
+static uint8_t FRAM_write_locked(uint8_t *pStructToSave, const uint16_t startAddress,
+                                 uint16_t sizeInByte) {
   HAL_SPI_StateTypeDef spiStatus;
 
   uint8_t command = WRITE;
@@ -79,7 +117,7 @@ uint8_t FRAM_write(uint8_t *pStructToSave, const uint16_t startAddress,
 
 }
 
-uint8_t FRAM_read(uint16_t startAddress, uint8_t *pData, uint16_t sizeInByte) {
+static uint8_t FRAM_read_locked(uint16_t startAddress, uint8_t *pData, uint16_t sizeInByte) {
   HAL_SPI_StateTypeDef spiStatus;
   uint8_t tx_dummy;
   uint8_t command = READ;
@@ -22,7 +22,7 @@
 uint8_t FRAM_init(void);
 
 /**
- * @brief write to FRAM
+ * @brief write to FRAM, the tasks of the scheduler tick interrupt wait for the transfer
  * @param pStructToSave: pointer to structer that should be saved
  * @param startAddress: address where struct is saved to
  * @param sizeInByte: size of struct to be saved
@@ -32,7 +32,7 @@ uint8_t FRAM_write(uint8_t *pStructToSave, const uint16_t startAddress,
                    uint16_t sizeInByte);
 
 /**
- * @brief write to FRAM
+ * @brief read from FRAM, the tasks of the scheduler tick interrupt wait for the transfer
  * @param pData: pointer to buffer where read data is saved to
  * @param startAddress: address where data is read from
  * @param sizeInByte: size of data to be read
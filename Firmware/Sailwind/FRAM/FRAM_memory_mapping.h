@@ -19,6 +19,7 @@
 /*Memory Region where linear_guide configurations are saved*/
 #define FRAM_MAX_RPM        0x0200
 #define FRAM_MAX_DELTA      0x0210
+#define FRAM_UDP_INTERVAL   0x0220
 
 #define STANDARD_IP_FIRST_OCTET   192
 #define STANDARD_IP_SECOND_OCTET  168
@@ -0,0 +1,167 @@
+/**
+ * \file ADC_Scan.c
+ * @date 17 Oct 2026
+ * @brief Timer triggered background scan of the analog inputs via DMA
+ */
+#include "ADC_Scan.h"
+
+/* typedefs -----------------------------------------------------------*/
+
+/** @struct ADC_Scan_t
+ *  @brief circular DMA buffer of one ADC
+ *  @var ADC_Scan_t::hadc_ptr
+ *  ADC pointer (NULL if the slot is unused)
+ *  @var ADC_Scan_t::buffer
+ *  interleaved conversions: buffer[sequence * num_of_ranks + rank - 1]
+ *  @var ADC_Scan_t::channels
+ *  channel programmed for each rank
+ *  @var ADC_Scan_t::configured_ranks
+ *  bit (rank - 1) is set, if channels[rank - 1] has been programmed
+ *  @var ADC_Scan_t::num_of_ranks
+ *  number of conversions of the regular sequence
+ *  @var ADC_Scan_t::is_running
+ *  DMA transfer is active with the current channel configuration
+ *  @var ADC_Scan_t::is_filled
+ *  set after the DMA has written the whole buffer once
+ */
+typedef struct {
+  ADC_HandleTypeDef *hadc_ptr;
+  uint16_t buffer[ADC_SCAN_DEPTH * ADC_SCAN_MAX_RANKS];
+  uint32_t channels[ADC_SCAN_MAX_RANKS];
+  uint8_t configured_ranks;
+  uint8_t num_of_ranks;
+  boolean_t is_running;
+  volatile boolean_t is_filled;
+} ADC_Scan_t;
+
+static ADC_Scan_t ADC_Scan_slots[ADC_SCAN_MAX_ADCS] = { 0 };
+
+/* private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief find the slot of an adc
+ * @param hadc_ptr: ptr to the adc instance
+ * @param create: if True an unused slot is assigned to the adc when it has none yet
+ * @retval ptr to the slot or NULL
+ */
+static ADC_Scan_t *ADC_Scan_get_slot(ADC_HandleTypeDef *hadc_ptr, boolean_t create);
+
+/* API function definitions -----------------------------------------------*/
+
+void ADC_Scan_init(TIM_HandleTypeDef *htim_trigger_ptr) {
+  if (HAL_TIM_Base_Start(htim_trigger_ptr) != HAL_OK) {
+    printf("ADC scan trigger timer could not be started\r\n");
+  }
+}
+
+uint8_t ADC_Scan_configure_channel(ADC_HandleTypeDef *hadc_ptr, uint32_t rank, uint32_t channel) {
+  ADC_Scan_t *scan_ptr = ADC_Scan_get_slot(hadc_ptr, True);
+  ADC_ChannelConfTypeDef sConfig = { 0 };
+  uint8_t rank_mask = 0U;
+
+  if (scan_ptr == NULL || rank == 0U || rank > ADC_SCAN_MAX_RANKS) {
+    printf("ADC scan: invalid rank\r\n");
+    return ADC_SCAN_ERROR;
+  }
+  rank_mask = 1U << (rank - 1U);
+  if ((scan_ptr->configured_ranks & rank_mask) && scan_ptr->channels[rank - 1U] == channel) {
+    return ADC_SCAN_OK;
+  }
+  if (scan_ptr->is_running) {
+    HAL_ADC_Stop_DMA(hadc_ptr);
+    scan_ptr->is_running = False;
+    scan_ptr->is_filled = False;
+  }
+  sConfig.Channel = channel;
+  sConfig.Rank = rank;
+  sConfig.SamplingTime = ADC_SCAN_SAMPLETIME;
+  if (HAL_ADC_ConfigChannel(hadc_ptr, &sConfig) != HAL_OK) {
+    return ADC_SCAN_ERROR;
+  }
+  scan_ptr->channels[rank - 1U] = channel;
+  scan_ptr->configured_ranks |= rank_mask;
+  return ADC_SCAN_OK;
+}
+
+uint8_t ADC_Scan_start(ADC_HandleTypeDef *hadc_ptr) {
+  ADC_Scan_t *scan_ptr = ADC_Scan_get_slot(hadc_ptr, True);
+  uint32_t tick_start = 0U;
+
+  if (scan_ptr == NULL || hadc_ptr->Init.NbrOfConversion > ADC_SCAN_MAX_RANKS) {
+    printf("ADC scan: no buffer for this adc\r\n");
+    return ADC_SCAN_ERROR;
+  }
+  if (scan_ptr->is_running) {
+    return scan_ptr->is_filled ? ADC_SCAN_OK : ADC_SCAN_NOT_READY;
+  }
+  scan_ptr->num_of_ranks = (uint8_t) hadc_ptr->Init.NbrOfConversion;
+  scan_ptr->is_filled = False;
+  if (HAL_ADC_Start_DMA(hadc_ptr, (uint32_t*) scan_ptr->buffer,
+                        ADC_SCAN_DEPTH * scan_ptr->num_of_ranks) != HAL_OK) {
+    printf("ADC scan: DMA could not be started\r\n");
+    return ADC_SCAN_ERROR;
+  }
+  scan_ptr->is_running = True;
+  tick_start = HAL_GetTick();
+  while (!scan_ptr->is_filled) {
+    if (HAL_GetTick() - tick_start > ADC_SCAN_FILL_TIMEOUT_MS) {
+      printf("ADC scan: no trigger received\r\n");
+      return ADC_SCAN_NOT_READY;
+    }
+  }
+  return ADC_SCAN_OK;
+}
+
+uint8_t ADC_Scan_get_samples(ADC_HandleTypeDef *hadc_ptr, uint32_t rank,
+                             uint16_t *samples, uint8_t num_of_samples) {
+  ADC_Scan_t *scan_ptr = ADC_Scan_get_slot(hadc_ptr, False);
+  uint32_t buffer_length = 0U;
+  uint32_t sequence = 0U;
+
+  if (scan_ptr == NULL || rank == 0U || rank > scan_ptr->num_of_ranks
+      || !(scan_ptr->configured_ranks & (1U << (rank - 1U)))
+      || num_of_samples > ADC_SCAN_DEPTH) {
+    return ADC_SCAN_ERROR;
+  }
+  if (!scan_ptr->is_filled) {
+    return ADC_SCAN_NOT_READY;
+  }
+  /* the DMA counter holds the remaining transfers until wrap around, so the sequence
+   * in front of the current write position is the newest complete one */
+  buffer_length = ADC_SCAN_DEPTH * scan_ptr->num_of_ranks;
+  sequence = (buffer_length - __HAL_DMA_GET_COUNTER(hadc_ptr->DMA_Handle))
+      / scan_ptr->num_of_ranks;
+  for (uint8_t i = 0U; i < num_of_samples; i++) {
+    sequence = sequence == 0U ? ADC_SCAN_DEPTH - 1U : sequence - 1U;
+    samples[i] = scan_ptr->buffer[sequence * scan_ptr->num_of_ranks + rank - 1U];
+  }
+  return ADC_SCAN_OK;
+}
+
+void ADC_Scan_callback_conversion_complete(ADC_HandleTypeDef *hadc_ptr) {
+  ADC_Scan_t *scan_ptr = ADC_Scan_get_slot(hadc_ptr, False);
+
+  if (scan_ptr != NULL) {
+    scan_ptr->is_filled = True;
+  }
+}
+
+/* private function definitions -----------------------------------------------*/
+
+static ADC_Scan_t *ADC_Scan_get_slot(ADC_HandleTypeDef *hadc_ptr, boolean_t create) {
+  ADC_Scan_t *free_slot_ptr = NULL;
+
+  for (uint8_t i = 0U; i < ADC_SCAN_MAX_ADCS; i++) {
+    if (ADC_Scan_slots[i].hadc_ptr == hadc_ptr) {
+      return &ADC_Scan_slots[i];
+    }
+    if (ADC_Scan_slots[i].hadc_ptr == NULL && free_slot_ptr == NULL) {
+      free_slot_ptr = &ADC_Scan_slots[i];
+    }
+  }
+  if (create && free_slot_ptr != NULL) {
+    free_slot_ptr->hadc_ptr = hadc_ptr;
+    return free_slot_ptr;
+  }
+  return NULL;
+}
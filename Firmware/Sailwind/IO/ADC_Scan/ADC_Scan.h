@@ -0,0 +1,75 @@
+/**
+ * \file ADC_Scan.h
+ * @date 17 Oct 2026
+ * @brief Timer triggered background scan of the analog inputs via DMA
+ *
+ * A hardware timer (TRGO) starts one regular sequence per period on every registered ADC.
+ * The DMA writes the conversions of the last ADC_SCAN_DEPTH sequences into a circular buffer,
+ * so the newest samples of every rank can be read at any time without waiting for a conversion.
+ * The channel of every rank is cached, so the sequence is only reprogrammed when it changes.
+ */
+
+#ifndef IO_ADC_SCAN_H_
+#define IO_ADC_SCAN_H_
+
+#include "stm32f4xx_hal.h"
+#include "boolean.h"
+#include <stdio.h>
+
+/* defines -----------------------------------------------------------*/
+#define ADC_SCAN_DEPTH               48U  /* number of sequences kept per rank */
+#define ADC_SCAN_MAX_RANKS           3U   /* maximum number of ranks of one sequence */
+#define ADC_SCAN_MAX_ADCS            2U   /* number of ADCs that can be scanned simultaneously */
+#define ADC_SCAN_FILL_TIMEOUT_MS     200U /* timeout for the first complete buffer after start */
+#define ADC_SCAN_SAMPLETIME          ADC_SAMPLETIME_480CYCLES
+
+#define ADC_SCAN_OK                  0
+#define ADC_SCAN_ERROR               1
+#define ADC_SCAN_NOT_READY           2
+
+/* API function prototypes -----------------------------------------------*/
+
+/**
+ * @brief start the trigger timer of the scan. The ADCs have to be configured with its TRGO as external trigger.
+ * @param htim_trigger_ptr: ptr to the trigger timer instance
+ * @retval none
+ */
+void ADC_Scan_init(TIM_HandleTypeDef *htim_trigger_ptr);
+
+/**
+ * @brief assign a channel to a rank of the regular sequence of an ADC.
+ *        The ADC is only reprogrammed (and its scan stopped) if the rank had another channel before.
+ * @param hadc_ptr: ptr to the adc instance
+ * @param rank: rank in the regular sequence (starting at 1)
+ * @param channel: ADC_CHANNEL_x
+ * @retval ADC_SCAN_OK or ADC_SCAN_ERROR
+ */
+uint8_t ADC_Scan_configure_channel(ADC_HandleTypeDef *hadc_ptr, uint32_t rank, uint32_t channel);
+
+/**
+ * @brief start the DMA transfer of an ADC and wait until its buffer has been filled once.
+ *        Does nothing if the scan is already running with the current channel configuration.
+ * @param hadc_ptr: ptr to the adc instance
+ * @retval ADC_SCAN_OK, ADC_SCAN_NOT_READY (buffer not filled within timeout) or ADC_SCAN_ERROR
+ */
+uint8_t ADC_Scan_start(ADC_HandleTypeDef *hadc_ptr);
+
+/**
+ * @brief copy the newest samples of one rank out of the DMA buffer (non blocking)
+ * @param hadc_ptr: ptr to the adc instance
+ * @param rank: rank of the channel in the regular sequence (starting at 1)
+ * @param samples: ptr to the destination array
+ * @param num_of_samples: number of samples to copy (at most ADC_SCAN_DEPTH)
+ * @retval ADC_SCAN_OK, ADC_SCAN_NOT_READY (buffer not filled yet) or ADC_SCAN_ERROR
+ */
+uint8_t ADC_Scan_get_samples(ADC_HandleTypeDef *hadc_ptr, uint32_t rank,
+                             uint16_t *samples, uint8_t num_of_samples);
+
+/**
+ * @brief has to be called in HAL_ADC_ConvCpltCallback
+ * @param hadc_ptr: ptr to the adc instance that completed the buffer
+ * @retval none
+ */
+void ADC_Scan_callback_conversion_complete(ADC_HandleTypeDef *hadc_ptr);
+
+#endif /* IO_ADC_SCAN_H_ */
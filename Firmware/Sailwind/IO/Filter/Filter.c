@@ -0,0 +1,134 @@
+/**
+ * \file Filter.c
+ * @date 17 Oct 2026
+ * @brief Outlier robust filters for batches of ADC samples
+ */
+#include "Filter.h"
+
+/* private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief partially reorder the samples in [left, right], so that samples[k] holds the value it would have
+ *        after sorting, all values in front of it are lower or equal and all behind it are greater or equal
+ * @param samples: ptr to the batch
+ * @param left: first index of the range
+ * @param right: last index of the range
+ * @param k: index to select (left <= k <= right)
+ * @retval none
+ */
+static void Filter_select(uint16_t *samples, int16_t left, int16_t right, int16_t k);
+
+static uint16_t Filter_median_of_three(uint16_t a, uint16_t b, uint16_t c);
+
+/* API function definitions -----------------------------------------------*/
+
+uint16_t Filter_apply(const Filter_config_t *config_ptr, uint16_t *samples) {
+  switch (config_ptr->type) {
+    case Filter_type_trimmed_mean:
+      return Filter_trimmed_mean(samples, config_ptr->num_of_samples,
+                                 config_ptr->num_of_dispersed_samples);
+    case Filter_type_median:
+      return Filter_median(samples, config_ptr->num_of_samples);
+    case Filter_type_mean:
+    default:
+      return Filter_mean(samples, config_ptr->num_of_samples);
+  }
+}
+
+uint16_t Filter_mean(const uint16_t *samples, uint8_t num_of_samples) {
+  uint32_t sum = 0U;
+
+  if (num_of_samples == 0U) {
+    return 0U;
+  }
+  for (uint8_t i = 0U; i < num_of_samples; i++) {
+    sum += samples[i];
+  }
+  return (uint16_t) (sum / num_of_samples);
+}
+
+uint16_t Filter_trimmed_mean(uint16_t *samples, uint8_t num_of_samples,
+                             uint8_t num_of_dispersed_samples) {
+  uint8_t cut = num_of_dispersed_samples / 2U;
+
+  if (cut == 0U) {
+    return Filter_mean(samples, num_of_samples);
+  }
+  if (2U * cut >= num_of_samples) {
+    return Filter_median(samples, num_of_samples);
+  }
+  /* move the lowest values in front of index cut, then the highest values behind the kept range */
+  Filter_select(samples, 0, num_of_samples - 1, cut);
+  Filter_select(samples, cut, num_of_samples - 1, num_of_samples - cut - 1);
+  return Filter_mean(&samples[cut], num_of_samples - 2U * cut);
+}
+
+uint16_t Filter_median(uint16_t *samples, uint8_t num_of_samples) {
+  uint8_t middle = num_of_samples / 2U;
+  uint16_t lower_middle = 0U;
+
+  if (num_of_samples == 0U) {
+    return 0U;
+  }
+  Filter_select(samples, 0, num_of_samples - 1, middle);
+  if (num_of_samples % 2U) {
+    return samples[middle];
+  }
+  /* the lower middle value is the maximum of the lower half */
+  lower_middle = samples[0];
+  for (uint8_t i = 1U; i < middle; i++) {
+    if (samples[i] > lower_middle) {
+      lower_middle = samples[i];
+    }
+  }
+  return (uint16_t) (((uint32_t) lower_middle + samples[middle]) / 2U);
+}
+
+/* private function definitions -----------------------------------------------*/
+
+static void Filter_select(uint16_t *samples, int16_t left, int16_t right, int16_t k) {
+  while (right > left) {
+    uint16_t pivot = Filter_median_of_three(samples[left],
+                                            samples[left + (right - left) / 2],
+                                            samples[right]);
+    int16_t i = left;
+    int16_t j = right;
+    uint16_t tmp = 0U;
+
+    while (i <= j) {
+      while (samples[i] < pivot) {
+        i++;
+      }
+      while (samples[j] > pivot) {
+        j--;
+      }
+      if (i <= j) {
+        tmp = samples[i];
+        samples[i] = samples[j];
+        samples[j] = tmp;
+        i++;
+        j--;
+      }
+    }
+    /* [left, j] <= pivot, (j, i) == pivot, [i, right] >= pivot */
+    if (k <= j) {
+      right = j;
+    } else if (k >= i) {
+      left = i;
+    } else {
+      return;
+    }
+  }
+}
+
+static uint16_t Filter_median_of_three(uint16_t a, uint16_t b, uint16_t c) {
+  if (a > b) {
+    uint16_t tmp = a;
+    a = b;
+    b = tmp;
+  }
+  if (b > c) {
+    b = c;
+  }
+  return a > b ? a : b;
+}
@@ -0,0 +1,74 @@
+/**
+ * \file Filter.h
+ * @date 17 Oct 2026
+ * @brief Outlier robust filters for batches of ADC samples
+ *
+ * The trimmed mean and the median are based on selection (quickselect) instead of a full sort,
+ * so a batch is filtered in linear expected time.
+ */
+
+#ifndef IO_FILTER_H_
+#define IO_FILTER_H_
+
+#include <stdint.h>
+
+/* typedefs -----------------------------------------------------------*/
+
+typedef enum {
+  Filter_type_mean,
+  Filter_type_trimmed_mean,
+  Filter_type_median
+} Filter_type_t;
+
+/** @struct Filter_config_t
+ *  @brief filter settings of one sensor type
+ *  @var Filter_config_t::type
+ *  filter that is applied to the batch
+ *  @var Filter_config_t::num_of_samples
+ *  number of samples of one batch
+ *  @var Filter_config_t::num_of_dispersed_samples
+ *  number of samples discarded by the trimmed mean (half of them at each end)
+ */
+typedef struct {
+  Filter_type_t type;
+  uint8_t num_of_samples;
+  uint8_t num_of_dispersed_samples;
+} Filter_config_t;
+
+/* API function prototypes -----------------------------------------------*/
+
+/**
+ * @brief apply the configured filter to a batch of samples
+ * @param config_ptr: ptr to the filter settings
+ * @param samples: ptr to the batch (config_ptr->num_of_samples values), gets reordered
+ * @retval filtered value
+ */
+uint16_t Filter_apply(const Filter_config_t *config_ptr, uint16_t *samples);
+
+/**
+ * @brief arithmetic mean
+ * @param samples: ptr to the batch
+ * @param num_of_samples: number of samples
+ * @retval mean value
+ */
+uint16_t Filter_mean(const uint16_t *samples, uint8_t num_of_samples);
+
+/**
+ * @brief mean of the samples left after discarding the lowest and highest values
+ * @param samples: ptr to the batch, gets reordered
+ * @param num_of_samples: number of samples
+ * @param num_of_dispersed_samples: number of discarded samples (half of them at each end)
+ * @retval trimmed mean value
+ */
+uint16_t Filter_trimmed_mean(uint16_t *samples, uint8_t num_of_samples,
+                             uint8_t num_of_dispersed_samples);
+
+/**
+ * @brief median (mean of both middle values for an even number of samples)
+ * @param samples: ptr to the batch, gets reordered
+ * @param num_of_samples: number of samples
+ * @retval median value
+ */
+uint16_t Filter_median(uint16_t *samples, uint8_t num_of_samples);
+
+#endif /* IO_FILTER_H_ */
@@ -4,6 +4,8 @@
  * @brief Access to Analog and Digital IO Pins
  */
 #include "IO.h"
+#include "ADC_Scan.h"
+#include "Filter.h"
 
 #define ADC_RESOLOUTION                               (4096 - 1)
 #define DAC_RESOLOUTION                               (4096 - 1)
@@ -18,9 +20,21 @@
 #define CURRENT_SENSOR_MIN_VOLT                       1.607
 #define NUM_OF_ADC_SAMPLES_DISTANCE_SENSOR            48
 #define NUM_OF_DISPERESED_SAMPLES_DISTANCE_SENSOR     44
+#define NUM_OF_ADC_SAMPLES                            48
 
 static IO_analogSensor_t IO_distance_sensor = { 0 };
 static IO_analogSensor_t IO_current_sensor = { 0 };
+
+/* filter applied to the adc samples, selected by the sensor type */
+static const Filter_config_t IO_filter_config[] = {
+  [Distance_Sensor] = { Filter_type_trimmed_mean, NUM_OF_ADC_SAMPLES_DISTANCE_SENSOR,
+      NUM_OF_DISPERESED_SAMPLES_DISTANCE_SENSOR },
+  [Wind_Sensor_speed] = { Filter_type_mean, NUM_OF_ADC_SAMPLES, 0 },
+  [Wind_Sensor_direction] = { Filter_type_mean, NUM_OF_ADC_SAMPLES, 0 },
+  [Current_Sensor] = { Filter_type_mean, NUM_OF_ADC_SAMPLES, 0 },
+  [Force_Sensor] = { Filter_type_median, NUM_OF_ADC_SAMPLES, 0 }
+};
+
 /* private function prototypes -----------------------------------------------*/
 
 static void IO_Select_ADC_CH(IO_analogSensor_t *Sensor);
@@ -28,24 +42,12 @@ static void IO_Select_ADC_CH(IO_analogSensor_t *Sensor);
 static void IO_convertToDAC(IO_analogActuator_t *actuator_ptr);
 
 /**
- * @brief Take adc values and remove lowest values. Takes an average of the left over values
- * @param num_of_adc_samples: number of taken adc values
- * @param num_of_disperesed_samples: number of adc values to be disposed
+ * @brief Take the newest adc values of the background scan and apply the filter of the sensor type
+ *        (see IO_filter_config). Does not wait for a conversion.
  * @param Sensor: ptr to a Sensor
  * @retval none
  */
-
-static void IO_Get_ADC_Value(uint8_t num_of_adc_samples,
-                             uint8_t num_of_disperesed_samples,
-                             IO_analogSensor_t *Sensor);
-
-/**
- * @brief Sort taken adc values from lowest to highest
- * @param ADC_Values: ptr to array of taken adc values
- * @param num_of_adc_samples: number of taken adc values
- * @retval none
- */
-static void IO_Sort_ADC_Values(uint16_t *ADC_values, uint8_t num_of_adc_samples);
+static void IO_Get_ADC_Value(IO_analogSensor_t *Sensor);
 
 /* IO_digitalPin_t IO_digital_Out_Pin_init(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState state)
  *  Description:
@@ -137,12 +139,8 @@ static void IO_convertToDAC(IO_analogActuator_t *actuator_ptr)
 }
 
 static void IO_Select_ADC_CH(IO_analogSensor_t *Sensor) {
-  ADC_ChannelConfTypeDef sConfig = { 0 };
-
-  sConfig.Channel = Sensor->ADC_Channel;
-  sConfig.Rank = Sensor->ADC_Rank;
-  sConfig.SamplingTime = ADC_SAMPLETIME_480CYCLES;
-  if (HAL_ADC_ConfigChannel(Sensor->hadc_ptr, &sConfig) != HAL_OK) {
+  if (ADC_Scan_configure_channel(Sensor->hadc_ptr, Sensor->ADC_Rank,
+                                 Sensor->ADC_Channel) != ADC_SCAN_OK) {
     Error_Handler();
   }
 }
@@ -150,13 +148,9 @@ static void IO_Select_ADC_CH(IO_analogSensor_t *Sensor) {
 void IO_Get_Measured_Value(IO_analogSensor_t *Sensor) {
   float ADC_voltage = 0.0;
 
-  IO_Select_ADC_CH(Sensor);
-
   switch (Sensor->Sensor_type) {
     case Distance_Sensor:
-      IO_Get_ADC_Value(NUM_OF_ADC_SAMPLES_DISTANCE_SENSOR,
-      NUM_OF_DISPERESED_SAMPLES_DISTANCE_SENSOR,
-                       Sensor);
+      IO_Get_ADC_Value(Sensor);
       ADC_voltage = (float) ((Sensor->ADC_value * 3.3) / ADC_RESOLOUTION);
       Sensor->measured_value =
           (uint16_t) (((Sensor->max_possible_value - Sensor->min_possible_value)
@@ -165,7 +159,7 @@ void IO_Get_Measured_Value(IO_analogSensor_t *Sensor) {
                   - DISTANCE_SENSOR_MIN_AMP)) + Sensor->min_possible_value;
       break;
     case Current_Sensor:
-      IO_Get_ADC_Value(48, 0, Sensor);
+      IO_Get_ADC_Value(Sensor);
       ADC_voltage = (float) ((Sensor->ADC_value * 3.3) / ADC_RESOLOUTION);
       Sensor->measured_value = (uint16_t) (((Sensor->max_possible_value
           - Sensor->min_possible_value)
@@ -174,7 +168,7 @@ void IO_Get_Measured_Value(IO_analogSensor_t *Sensor) {
           + Sensor->min_possible_value;
       break;
     case Wind_Sensor_speed:
-      IO_Get_ADC_Value(48, 0, Sensor);
+      IO_Get_ADC_Value(Sensor);
       ADC_voltage = (float) (Sensor->ADC_value * 3.3 / ADC_RESOLOUTION);
       Sensor->measured_value = (int16_t) (((Sensor->max_possible_value
           - Sensor->min_possible_value)
@@ -182,7 +176,7 @@ void IO_Get_Measured_Value(IO_analogSensor_t *Sensor) {
           * (ADC_voltage - WIND_SENSOR_MIN_AMP)) + Sensor->min_possible_value;
       break;
     case Wind_Sensor_direction:
-      IO_Get_ADC_Value(48, 0, Sensor);
+      IO_Get_ADC_Value(Sensor);
       ADC_voltage = (float) (Sensor->ADC_value * 3.3 / ADC_RESOLOUTION);
       Sensor->measured_value = (int16_t) (((Sensor->max_possible_value
           - Sensor->min_possible_value)
@@ -196,44 +190,16 @@ void IO_Get_Measured_Value(IO_analogSensor_t *Sensor) {
   }
 }
 
-static void IO_Get_ADC_Value(uint8_t num_of_adc_samples,
-                             uint8_t num_of_disperesed_samples,
-                             IO_analogSensor_t *Sensor) {
+static void IO_Get_ADC_Value(IO_analogSensor_t *Sensor) {
+  const Filter_config_t *config_ptr = &IO_filter_config[Sensor->Sensor_type];
+  uint16_t ADC_val[NUM_OF_ADC_SAMPLES];
 
-  uint16_t ADC_val[num_of_adc_samples];
-  uint32_t All_ADC_val = 0;
-
-  for (uint8_t i = 0; i < num_of_adc_samples; i++) {
-    HAL_ADC_Start(Sensor->hadc_ptr);
-    HAL_ADC_PollForConversion(Sensor->hadc_ptr, HAL_MAX_DELAY);
-    ADC_val[i] = HAL_ADC_GetValue(Sensor->hadc_ptr);
-    HAL_ADC_Stop(Sensor->hadc_ptr);
-  }
-  IO_Sort_ADC_Values(ADC_val, num_of_adc_samples);
-  for (uint8_t i = num_of_disperesed_samples / 2;
-      i < num_of_adc_samples - num_of_disperesed_samples / 2; i++) {
-    All_ADC_val += ADC_val[i];
-  }
-  Sensor->ADC_value = (uint16_t) (All_ADC_val
-      / (num_of_adc_samples - num_of_disperesed_samples));
-
-}
-
-static void IO_Sort_ADC_Values(uint16_t *ADC_values, uint8_t num_of_adc_samples) {
-  uint8_t exchange = 1U;
-  uint16_t tmp = 0U;
-  /* Sort tab */
-  while (exchange == 1) {
-    exchange = 0;
-    for (uint8_t i = 0U; i < num_of_adc_samples - 1U; i++) {
-      if (ADC_values[i] > ADC_values[i + 1U]) {
-        tmp = ADC_values[i];
-        ADC_values[i] = ADC_values[i + 1U];
-        ADC_values[i + 1U] = tmp;
-        exchange = 1U;
-      }
-    }
+  if (ADC_Scan_get_samples(Sensor->hadc_ptr, Sensor->ADC_Rank, ADC_val,
+                           config_ptr->num_of_samples) != ADC_SCAN_OK) {
+    /* keep the previous value */
+    return;
   }
+  Sensor->ADC_value = Filter_apply(config_ptr, ADC_val);
 }
 
 void IO_init_distance_sensor(ADC_HandleTypeDef *hadc1) {
@@ -243,6 +209,8 @@ void IO_init_distance_sensor(ADC_HandleTypeDef *hadc1) {
   IO_distance_sensor.ADC_Rank = 1;
   IO_distance_sensor.max_possible_value = 730;
   IO_distance_sensor.min_possible_value = 30;
+  IO_Select_ADC_CH(&IO_distance_sensor);
+  ADC_Scan_start(hadc1);
   IO_Get_Measured_Value(&IO_distance_sensor);
   printf("distance sensor init done\r\n");
   printf("init distance: %umm\r\n", IO_distance_sensor.measured_value);
@@ -255,6 +223,8 @@ void IO_init_current_sensor(ADC_HandleTypeDef *hadc3) {
   IO_current_sensor.ADC_Rank = 1;
   IO_current_sensor.max_possible_value = 7250;
   IO_current_sensor.min_possible_value = 0;
+  IO_Select_ADC_CH(&IO_current_sensor);
+  ADC_Scan_start(hadc3);
   IO_Get_Measured_Value(&IO_current_sensor);
   printf("current sensor init done\r\n");
   printf("init current: %umA\r\n", IO_current_sensor.measured_value);
@@ -269,13 +239,16 @@ void IO_init_wind_sensor(IO_analogSensor_t *wind_sensor_speed,
   wind_sensor_speed->ADC_Rank = 2;
   wind_sensor_speed->max_possible_value = 16667;
   wind_sensor_speed->min_possible_value = 0;
-  IO_Get_Measured_Value(wind_sensor_speed);
   wind_sensor_direction->Sensor_type = Wind_Sensor_direction;
   wind_sensor_direction->ADC_Channel = ADC_CHANNEL_5;
   wind_sensor_direction->hadc_ptr = hadc3;
   wind_sensor_direction->ADC_Rank = 3;
   wind_sensor_direction->max_possible_value = 0;
   wind_sensor_direction->min_possible_value = 359;
+  IO_Select_ADC_CH(wind_sensor_speed);
+  IO_Select_ADC_CH(wind_sensor_direction);
+  ADC_Scan_start(hadc3);
+  IO_Get_Measured_Value(wind_sensor_speed);
   IO_Get_Measured_Value(wind_sensor_direction);
   printf("wind sensor init done\r\n");
   printf("init speed:%umm/s\r\n init dir:%u°\r\n",
@@ -108,7 +108,8 @@ void IO_init_wind_sensor(IO_analogSensor_t *wind_sensor_speed,
                          ADC_HandleTypeDef *hadc3);
 
 /**
- * @brief get the measured value of a sensor as the real output value depending on the sensor type
+ * @brief get the measured value of a sensor as the real output value depending on the sensor type.
+ *        Uses the newest samples of the background ADC scan and does not wait for a conversion.
  * @param Sensor: ptr to a Sensor
  * @retval none
  */
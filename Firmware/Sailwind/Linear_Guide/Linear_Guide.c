@@ -7,18 +7,23 @@
 #include "Linear_Guide.h"
 #include "FRAM.h"
 #include <stdlib.h>
+#include <math.h>
 #include "FRAM_memory_mapping.h"
 
 
 /* defines ------------------------------------------------------------*/
-#define LG_DISTANCE_MM_PER_ROTATION 1.12F
-#define LG_DISTANCE_MM_PER_PULSE LG_DISTANCE_MM_PER_ROTATION/MOTOR_PULSE_PER_ROTATION
+#define LG_DISTANCE_UM_PER_ROTATION 1120
+#define LG_DISTANCE_MM_PER_ROTATION (LG_DISTANCE_UM_PER_ROTATION / 1000.0F)
+#define LG_DISTANCE_PER_PULSE_Q16 (((int32_t) LG_DISTANCE_UM_PER_ROTATION << LOC_Q16_SHIFT) / MOTOR_PULSE_PER_ROTATION)
 #define LG_STANDARD_MAX_DISTANCE_DELTA_MM 10
 #define LG_CURRENT_FAULT_TOLERANCE_MA 4000
 #define LG_FAULT_CHECK_POSITIVE -1
 #define LG_FAULT_CHECK_NEGATIVE 0
 #define LG_FAULT_CHECK_SKIPPED 1
-#define LG_BRAKE_PATH_OFFSET_REL 1.25F
+#define LG_MAX_ACCELERATION_RPM_PER_S 770 // former speed ramp: 10 rpm every 13 ms
+#define LG_MAX_JERK_RPM_PER_S2 3850 // full acceleration after 0.2 s
+#define LG_POSITION_TOLERANCE_MM 0.5F // half the resolution of the desired position
+#define LG_CONTROL_CYCLE_S 0.001F // period of the control task
 #define LG_SET_CENTER_OK 0
 #define LG_SET_CENTER_NOT_TRIGGERED 1
 
@@ -40,6 +45,24 @@ static LG_Endswitches_t Linear_Guide_Endswitches_init();
  * @retval lg_leds: struct of all LEDs as members
  */
 static LG_LEDs_t Linear_Guide_LEDs_init(LG_operating_mode_t op_mode, TIM_HandleTypeDef *htim_blink_ptr);
+/**
+ * @brief initialise the motion planner with the limits of the linear guide
+ * @param normal_rpm: normal speed of the motor, velocity limit
+ * @retval planner at rest
+ */
+static Motion_Planner_t Linear_Guide_Motion_Planner_init(uint16_t normal_rpm);
+/**
+ * @brief convert a motor speed to the velocity of the linear guide
+ * @param rpm: motor speed
+ * @retval velocity in mm/s
+ */
+static float Linear_Guide_rpm_to_mm_per_s(float rpm);
+/**
+ * @brief convert a velocity of the linear guide to the motor speed
+ * @param mm_per_s: velocity
+ * @retval motor speed in rpm
+ */
+static float Linear_Guide_mm_per_s_to_rpm(float mm_per_s);
 /**
  * @brief update the operating mode LEDs when mode has changed
  * @param lg_ptr: linear_guide reference
@@ -67,7 +90,7 @@ static int8_t Linear_Guide_update_sail_adjustment_mode(Linear_Guide_t *lg_ptr);
 static int8_t Linear_Guide_get_adjustment_mode(LG_sail_adjustment_mode_t last_mode, int16_t distance_to_center);
 static uint16_t Linear_Guide_get_adjustment_range_mm(Linear_Guide_t lg, LG_sail_adjustment_mode_t adjustment_mode);
 /**
- * @brief update speed ramp and movement depending on desired position
+ * @brief update motion planner and movement depending on desired position
  * @param lg_ptr: linear_guide reference
  * @param update_status: immediate stop, if emergency shutdown is set
  * @retval none
@@ -103,13 +126,6 @@ static int8_t Linear_Guide_check_current_fault(Linear_Guide_t *lg_ptr);
  * @retval fault_check_status
  */
 static int8_t Linear_Guide_check_wind_fault(Linear_Guide_t *lg_ptr);
-/**
- * @brief calculate brake path for current normal speed and safe it in localization member
- * @param lg_ptr: linear_guide reference
- * @retval none
- */
-static void Linear_Guide_calculate_break_path(Linear_Guide_t *lg_ptr);
-
 /**
  * @brief readout saved max distance delta
  * @param none
@@ -118,17 +134,18 @@ static void Linear_Guide_calculate_break_path(Linear_Guide_t *lg_ptr);
 static uint8_t Linear_Guide_read_max_distance_delta(void);
 
 /* API function definitions --------------------------------------------------*/
-void Linear_Guide_init(DAC_HandleTypeDef *hdac_ptr, TIM_HandleTypeDef *htim_blink_ptr)
+void Linear_Guide_init(DAC_HandleTypeDef *hdac_ptr, TIM_HandleTypeDef *htim_blink_ptr, TIM_HandleTypeDef *htim_pulse_ptr)
 {
 	LG_linear_guide.error_state = LG_error_state_0_normal;
 	LG_linear_guide.operating_mode = LG_operating_mode_manual;
 	LG_linear_guide.motor = Motor_init(hdac_ptr);
+	LG_linear_guide.planner = Linear_Guide_Motion_Planner_init(LG_linear_guide.motor.normal_rpm);
 	LG_linear_guide.localization = Linear_Guide_read_Localization();
+	LG_linear_guide.pulse_counter = Pulse_Counter_init(htim_pulse_ptr, &LG_linear_guide.motor.OUT3_rot_dir);
 	LG_linear_guide.endswitches = Linear_Guide_Endswitches_init();
 	LG_distance_sensor_ptr = IO_get_distance_sensor();
 	LG_current_sensor_ptr = IO_get_current_sensor();
 	LG_linear_guide.max_distance_fault = Linear_Guide_read_max_distance_delta();
-	Linear_Guide_calculate_break_path(&LG_linear_guide);
 	Linear_Guide_set_operating_mode(&LG_linear_guide, LG_operating_mode_automatic);
 	LG_linear_guide.leds = Linear_Guide_LEDs_init(LG_linear_guide.operating_mode, htim_blink_ptr);
 }
@@ -150,6 +167,7 @@ LG_LEDs_t Linear_Guide_LEDs_init(LG_operating_mode_t op_mode, TIM_HandleTypeDef
 
 int8_t Linear_Guide_update(Linear_Guide_t *lg_ptr)
 {
+	Localization_add_pulses(&lg_ptr->localization, Pulse_Counter_update(&lg_ptr->pulse_counter));
 	int8_t update_status = Linear_Guide_error_handler(lg_ptr);
 	Linear_Guide_update_movement(lg_ptr, update_status);
 	if (Localization_update_position(&lg_ptr->localization) == LOC_POSITION_UPDATED)
@@ -171,30 +189,27 @@ int8_t Linear_Guide_set_operating_mode(Linear_Guide_t *lg_ptr, LG_operating_mode
 	return LG_SWITCH_OPERATING_MODE_OK;
 }
 
-void Linear_Guide_callback_motor_pulse_capture(Linear_Guide_t *lg_ptr)
-{
-	Localization_callback_pulse_count(&lg_ptr->localization);
-}
-
 int8_t Linear_Guide_move(Linear_Guide_t *lg_ptr, Loc_movement_t movement, boolean_t immediate)
 {
-	if (movement == lg_ptr->localization.movement && (movement == Loc_movement_stop || !Motor_is_currently_braking(lg_ptr->motor)))
+	Motion_Planner_t *planner_ptr = &lg_ptr->planner;
+	if (movement == Loc_movement_stop && immediate)
 	{
-		return LG_MOVEMENT_RETAINED;
+		Motion_Planner_stop_immediately(planner_ptr);
+		Motor_set_velocity(&lg_ptr->motor, 0);
+		lg_ptr->localization.movement = Loc_movement_stop;
+		return LG_MOVEMENT_CHANGED;
 	}
-	switch(movement)
+	float velocity = 0.0F;
+	if (movement != Loc_movement_stop)
 	{
-		case Loc_movement_stop:
-			Motor_stop_moving(&lg_ptr->motor, immediate); break;
-		case Loc_movement_backwards:
-			Motor_start_moving(&lg_ptr->motor, Motor_function_cw_rotation); break;
-		case Loc_movement_forward:
-			Motor_start_moving(&lg_ptr->motor, Motor_function_ccw_rotation); break;
+		int8_t sign = movement == Loc_movement_backwards ? 1 : -1;
+		velocity = sign * Linear_Guide_rpm_to_mm_per_s(lg_ptr->motor.normal_rpm);
 	}
-	if (movement != Loc_movement_stop || immediate)
+	if (planner_ptr->mode == Motion_Planner_mode_velocity && planner_ptr->target_velocity == velocity)
 	{
-		lg_ptr->localization.movement = movement;
+		return LG_MOVEMENT_RETAINED;
 	}
+	Motion_Planner_set_target_velocity(planner_ptr, velocity);
 	return LG_MOVEMENT_CHANGED;
 }
 
@@ -207,18 +222,26 @@ void Linear_Guide_manual_move(Linear_Guide_t *lg_ptr, Loc_movement_t movement)
 	Localization_t *loc_ptr = &lg_ptr->localization;
 	if (movement == Loc_movement_stop)
 	{
-		int8_t sign = loc_ptr->movement == Loc_movement_backwards ? 1 : -1;
-		loc_ptr->desired_pos_mm = loc_ptr->current_pos_mm + sign * loc_ptr->brake_path_mm;
-		if (abs(loc_ptr->current_pos_mm) != loc_ptr->end_pos_mm)
+		/* stop on the next mm that can be reached with the limits of the motion planner */
+		float velocity = lg_ptr->planner.velocity;
+		float stop_pos_mm = loc_ptr->current_pos_um / (float) LOC_UM_PER_MM;
+		if (velocity > 0.0F)
+		{
+			loc_ptr->desired_pos_mm = (int16_t) ceilf(stop_pos_mm + Motion_Planner_get_stop_distance(&lg_ptr->planner));
+		}
+		else if (velocity < 0.0F)
+		{
+			loc_ptr->desired_pos_mm = (int16_t) floorf(stop_pos_mm - Motion_Planner_get_stop_distance(&lg_ptr->planner));
+		}
+		else
 		{
-			loc_ptr->desired_pos_queue = loc_ptr->current_pos_mm;
+			loc_ptr->desired_pos_mm = loc_ptr->current_pos_mm;
 		}
 	}
 	else
 	{
 		int8_t sign = movement == Loc_movement_backwards ? 1 : -1;
-		int16_t desired_pos_mm = sign * loc_ptr->end_pos_mm;
-		Localization_set_desired_pos_queued(loc_ptr, desired_pos_mm, movement);
+		loc_ptr->desired_pos_mm = sign * loc_ptr->end_pos_mm;
 	}
 }
 
@@ -237,8 +260,7 @@ void Linear_Guide_set_desired_roll_pitch_percentage(Linear_Guide_t *lg_ptr, int8
 	Localization_t *loc_ptr = &lg_ptr->localization;
 	LG_sail_adjustment_mode_t mode = Linear_Guide_get_adjustment_mode(lg_ptr->sail_adjustment_mode, percentage);
 	uint16_t range_mm = Linear_Guide_get_adjustment_range_mm(*lg_ptr, mode);
-	int16_t desired_pos_mm = (int16_t) (loc_ptr->center_pos_mm + range_mm * (percentage / 100.0F));
-	Localization_set_desired_pos_queued(loc_ptr, desired_pos_mm, Localization_get_next_movement(*loc_ptr, desired_pos_mm));
+	loc_ptr->desired_pos_mm = (int16_t) (loc_ptr->center_pos_mm + range_mm * (percentage / 100.0F));
 }
 
 int8_t Linear_Guide_get_current_roll_pitch_percentage(Linear_Guide_t lg)
@@ -251,13 +273,13 @@ int8_t Linear_Guide_get_current_roll_pitch_percentage(Linear_Guide_t lg)
 
 void Linear_Guide_change_speed_rpm(Linear_Guide_t *lg_ptr, uint16_t speed_rpm)
 {
+	Motion_Planner_t *planner_ptr = &lg_ptr->planner;
 	lg_ptr->motor.normal_rpm = speed_rpm;
-	if (lg_ptr->localization.movement != Loc_movement_stop)
+	planner_ptr->limits.max_velocity = Linear_Guide_rpm_to_mm_per_s(speed_rpm);
+	if (planner_ptr->mode == Motion_Planner_mode_velocity && planner_ptr->target_velocity != 0.0F)
 	{
-		lg_ptr->motor.ramp_final_rpm = lg_ptr->motor.normal_rpm;
-		lg_ptr->motor.ramp_activated = True;
+		Motion_Planner_set_target_velocity(planner_ptr, copysignf(planner_ptr->limits.max_velocity, planner_ptr->target_velocity));
 	}
-	Linear_Guide_calculate_break_path(lg_ptr);
 }
 
 boolean_t Linear_Guide_Endswitch_detected(Endswitch_t *endswitch_ptr)
@@ -286,7 +308,7 @@ Localization_t Linear_Guide_read_Localization()
 	uint8_t FRAM_buffer[sizeof(Loc_safe_data_t)];
 	FRAM_init();
 	FRAM_read(LINEAR_GUIDE_INFOS, FRAM_buffer, sizeof(Loc_safe_data_t));
-	return Localization_init(LG_DISTANCE_MM_PER_PULSE, FRAM_buffer);
+	return Localization_init(LG_DISTANCE_PER_PULSE_Q16, FRAM_buffer);
 }
 
 int8_t Linear_Guide_set_center(Linear_Guide_t *lg_ptr)
@@ -296,7 +318,7 @@ int8_t Linear_Guide_set_center(Linear_Guide_t *lg_ptr)
 	{
 		return LG_SET_CENTER_NOT_TRIGGERED;
 	}
-	printf("pulses:%d\r\n", loc_ptr->pulse_count);
+	printf("pulses:%ld\r\n", loc_ptr->pulse_count);
 	printf("center set at: %d mm!\r\n", loc_ptr->current_pos_mm);
 	Localization_set_center(loc_ptr);
 	Linear_Guide_safe_Localization(*loc_ptr);
@@ -313,6 +335,28 @@ void Linear_Guide_set_startpos(Linear_Guide_t *lg_ptr)
 
 /* private function definitions -----------------------------------------------*/
 
+static Motion_Planner_t Linear_Guide_Motion_Planner_init(uint16_t normal_rpm)
+{
+	Motion_Planner_limits_t limits = {
+			.max_velocity = Linear_Guide_rpm_to_mm_per_s(normal_rpm),
+			.max_acceleration = Linear_Guide_rpm_to_mm_per_s(LG_MAX_ACCELERATION_RPM_PER_S),
+			.max_jerk = Linear_Guide_rpm_to_mm_per_s(LG_MAX_JERK_RPM_PER_S2),
+			.position_tolerance = LG_POSITION_TOLERANCE_MM,
+			.cycle_time = LG_CONTROL_CYCLE_S
+	};
+	return Motion_Planner_init(limits);
+}
+
+static float Linear_Guide_rpm_to_mm_per_s(float rpm)
+{
+	return rpm / 60.0F * LG_DISTANCE_MM_PER_ROTATION;
+}
+
+static float Linear_Guide_mm_per_s_to_rpm(float mm_per_s)
+{
+	return mm_per_s * 60.0F / LG_DISTANCE_MM_PER_ROTATION;
+}
+
 static LG_Endswitches_t Linear_Guide_Endswitches_init()
 {
 	LG_Endswitches_t lg_endswitches = {
@@ -350,6 +394,12 @@ static int8_t Linear_Guide_update_sail_adjustment_mode(Linear_Guide_t *lg_ptr)
 	return LG_ADJUSTMENT_MODE_UPDATED;
 }
 
+/* static void Linear_Guide_update_movement(Linear_Guide_t *lg_ptr, int8_t update_status)
+ *  Description:
+ *   - once the range is known, the motion planner follows the desired position, also when it changes while moving
+ *   - an endswitch only stops the movement towards it, the desired position is moved to the endswitch
+ *   - the planned velocity is the set point of the motor, the motor is left untouched while the planner is idle
+ */
 static void Linear_Guide_update_movement(Linear_Guide_t *lg_ptr, int8_t update_status)
 {
 	if (update_status == LG_UPDATE_EMERGENCY_SHUTDOWN)
@@ -358,47 +408,53 @@ static void Linear_Guide_update_movement(Linear_Guide_t *lg_ptr, int8_t update_s
 		return;
 	}
 	Localization_t *loc_ptr = &lg_ptr->localization;
+	Motion_Planner_t *planner_ptr = &lg_ptr->planner;
 	if (loc_ptr->state >= Loc_state_3_approach_center)
 	{
 		boolean_t immediate = False;
-		Loc_movement_t movement = Localization_get_next_movement(*loc_ptr, loc_ptr->desired_pos_mm);
 		if (Linear_Guide_Endswitch_detected(&lg_ptr->endswitches.front))
 		{
 			IO_Get_Measured_Value(LG_distance_sensor_ptr);
 			Localization_set_startpos_abs(loc_ptr, LG_distance_sensor_ptr->measured_value);
-			immediate = True;
+			immediate = (boolean_t) (planner_ptr->velocity < 0.0F);
 		}
 		else if (Linear_Guide_Endswitch_detected(&lg_ptr->endswitches.back))
 		{
 			Localization_set_endpos(loc_ptr);
-			immediate = True;
+			immediate = (boolean_t) (planner_ptr->velocity > 0.0F);
 		}
 		if (immediate)
 		{
-			movement = Loc_movement_stop;
-			loc_ptr->desired_pos_queue = LOC_DESIRED_POS_QUEUE_EMPTY;
+			int8_t sign = planner_ptr->velocity > 0.0F ? 1 : -1;
+			loc_ptr->desired_pos_mm = sign * loc_ptr->end_pos_mm;
+			Linear_Guide_move(lg_ptr, Loc_movement_stop, True);
+			return;
 		}
-		Linear_Guide_move(lg_ptr, movement, immediate);
+		Motion_Planner_set_target_position(planner_ptr, loc_ptr->desired_pos_mm);
 	}
-	int8_t speed_ramp_status = Motor_speed_ramp(&lg_ptr->motor);
-	if (speed_ramp_status >= MOTOR_RAMP_NEXT_STEP)
+	else if (planner_ptr->mode == Motion_Planner_mode_position)
 	{
-		Linear_Guide_calculate_break_path(lg_ptr);
-		if (speed_ramp_status == MOTOR_RAMP_STOPPED)
-		{
-			loc_ptr->movement = Loc_movement_stop;
-			Localization_progress_queue(loc_ptr);
-		}
+		/* localization restarted */
+		Motion_Planner_set_target_velocity(planner_ptr, 0.0F);
 	}
-}
-
-static void Linear_Guide_calculate_break_path(Linear_Guide_t *lg_ptr)
-{
-	float dv = MOTOR_RAMP_STEP_RPM / 60.0F * LG_DISTANCE_MM_PER_ROTATION;
-	float a = dv / (MOTOR_RAMP_STEP_MS / 1000.0F);
-	float v_current = lg_ptr->motor.rpm_set_point / 60.0F * LG_DISTANCE_MM_PER_ROTATION;
-	float tb = v_current / a;
-	lg_ptr->localization.brake_path_mm = (v_current * tb - 0.5 * a * tb * tb)*LG_BRAKE_PATH_OFFSET_REL;
+	if (Motion_Planner_update(planner_ptr, loc_ptr->current_pos_um / (float) LOC_UM_PER_MM) == MOTION_PLANNER_IDLE)
+	{
+		return;
+	}
+	Motor_set_velocity(&lg_ptr->motor, (int16_t) lroundf(Linear_Guide_mm_per_s_to_rpm(planner_ptr->velocity)));
+	if (planner_ptr->velocity > 0.0F)
+	{
+		loc_ptr->movement = Loc_movement_backwards;
+	}
+	else if (planner_ptr->velocity < 0.0F)
+	{
+		loc_ptr->movement = Loc_movement_forward;
+	}
+	else
+	{
+		loc_ptr->movement = Loc_movement_stop;
+	}
+	loc_ptr->brake_path_mm = (uint16_t) ceilf(Motion_Planner_get_stop_distance(planner_ptr));
 }
 
 static int8_t Linear_Guide_error_handler(Linear_Guide_t *lg_ptr)
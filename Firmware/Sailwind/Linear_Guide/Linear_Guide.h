@@ -11,6 +11,8 @@
 #include "Motor.h"
 #include "Endswitch.h"
 #include "Localization.h"
+#include "Pulse_Counter.h"
+#include "Motion_Planner.h"
 
 #define LG_MOVEMENT_CHANGED 0
 #define LG_MOVEMENT_RETAINED 1
@@ -64,6 +66,8 @@ typedef struct {
 	LG_sail_adjustment_mode_t sail_adjustment_mode;
 	Motor_t motor;
 	Localization_t localization;
+	Pulse_Counter_t pulse_counter;
+	Motion_Planner_t planner;
 	LG_Endswitches_t endswitches;
 	LG_LEDs_t leds;
 	uint8_t max_distance_fault;
@@ -74,9 +78,11 @@ typedef struct {
 /**
  * @brief initialise the linear_guide object
  * @param hdac_ptr: dac handle object passed to motor member, that uses an analog signal for speed control
+ * @param htim_blink_ptr: timer of the blinking LEDs
+ * @param htim_pulse_ptr: timer capturing the motor pulse signal
  * @retval none
  */
-void Linear_Guide_init(DAC_HandleTypeDef *hdac_ptr, TIM_HandleTypeDef *htim_blink_ptr);
+void Linear_Guide_init(DAC_HandleTypeDef *hdac_ptr, TIM_HandleTypeDef *htim_blink_ptr, TIM_HandleTypeDef *htim_pulse_ptr);
 /**
  * @brief update status variables of the linear guide (movement, position, sail adjustment mode, errors)
  * @param lg_ptr: linear_guide reference
@@ -91,15 +97,9 @@ int8_t Linear_Guide_update(Linear_Guide_t *lg_ptr);
  */
 int8_t Linear_Guide_set_operating_mode(Linear_Guide_t *lg_ptr, LG_operating_mode_t operating_mode);
 /**
- * @brief count up or down pulse count depending on the movement direction (to be called in external interrupt callback from motor pulse signal)
- * @param lg_ptr: linear_guide reference
- * @retval none
- */
-void Linear_Guide_callback_motor_pulse_capture(Linear_Guide_t *lg_ptr);
-/**
- * @brief start / (stop) motor in given direction (activates motor speed ramp)
+ * @brief ramp the motor to normal speed in given direction or to a stop (velocity mode of the motion planner)
  * @param direction
- * @param immediate: if immediate stop is required
+ * @param immediate: if immediate stop is required (no ramp)
  * @retval movement_status: (if movement has changed or not)
  */
 int8_t Linear_Guide_move(Linear_Guide_t *lg_ptr, Loc_movement_t direction, boolean_t immediate);
@@ -135,7 +135,7 @@ int8_t Linear_Guide_get_current_roll_pitch_percentage(Linear_Guide_t lg);
  */
 boolean_t Linear_Guide_Endswitch_detected(Endswitch_t *endswitch_ptr);
 /**
- * @brief set normal speed of the motor (final value of speed ramp)
+ * @brief set normal speed of the motor (velocity limit of the motion planner)
  * @param lg_ptr: linear_guide reference
  * @param speed_rpm: pass speed value in rpm
  * @retval none
@@ -13,11 +13,10 @@
 
 /* private function prototypes -----------------------------------------------*/
 static int8_t Localization_deserialize(Localization_t *loc_ptr, uint8_t serial_buffer[sizeof(Loc_safe_data_t)]);
-static int16_t Localization_pulse_count_to_distance(Localization_t loc);
-static boolean_t Localization_target_on_the_way(Localization_t loc, int16_t desired_pos_mm);
+static int32_t Localization_pulse_count_to_distance_um(Localization_t loc);
 
 /* API function definitions -----------------------------------------------*/
-Localization_t Localization_init(float distance_per_pulse, uint8_t serial_buffer[sizeof(Loc_safe_data_t)])
+Localization_t Localization_init(int32_t distance_per_pulse_q16, uint8_t serial_buffer[sizeof(Loc_safe_data_t)])
 {
 	Localization_t localization = {
 			.is_localized = False,
@@ -26,8 +25,7 @@ Localization_t Localization_init(float distance_per_pulse, uint8_t serial_buffer
 			.state = Loc_state_0_init,
 			.center_pos_mm = 0,
 			.pulse_count = 0,
-			.distance_per_pulse = distance_per_pulse,
-			.desired_pos_queue = LOC_DESIRED_POS_QUEUE_EMPTY
+			.distance_per_pulse_q16 = distance_per_pulse_q16
 	};
 	int8_t recovery_state = Localization_deserialize(&localization, serial_buffer);
 	Localization_recover(&localization, recovery_state, False);
@@ -40,7 +38,6 @@ void Localization_reset(Localization_t *loc_ptr, boolean_t direct_trigger)
 	loc_ptr->recovery_state = LOC_RECOVERY_RESET;
 	loc_ptr->is_localized = False;
 	loc_ptr->is_triggered = direct_trigger;
-	loc_ptr->desired_pos_queue = LOC_DESIRED_POS_QUEUE_EMPTY;
 }
 /* void Localization_set_endpos(Localization_t *loc_ptr)
  *  Description:
@@ -50,8 +47,9 @@ void Localization_reset(Localization_t *loc_ptr, boolean_t direct_trigger)
  */
 void Localization_set_endpos(Localization_t *loc_ptr)
 {
-	loc_ptr->end_pos_mm = Localization_pulse_count_to_distance(*loc_ptr)/2;
+	loc_ptr->end_pos_mm = Localization_pulse_count_to_distance_um(*loc_ptr) / LOC_UM_PER_MM / 2;
 	loc_ptr->current_pos_mm = loc_ptr->end_pos_mm;
+	loc_ptr->current_pos_um = loc_ptr->current_pos_mm * LOC_UM_PER_MM;
 }
 
 /* void Localization_set_center(Localization_t *loc_ptr)
@@ -76,23 +74,20 @@ void Localization_parse_distance_sensor_value(Localization_t *loc_ptr, uint16_t
 	loc_ptr->current_measured_pos_mm = measured_value - loc_ptr->start_pos_abs_mm - loc_ptr->end_pos_mm;
 }
 
-void Localization_callback_pulse_count(Localization_t *loc_ptr)
+/* void Localization_add_pulses(Localization_t *loc_ptr, int16_t pulses)
+ *  Description:
+ *   - add the pulses counted by the hardware since the last update, positive while moving backwards
+ */
+void Localization_add_pulses(Localization_t *loc_ptr, int16_t pulses)
 {
-	switch(loc_ptr->movement)
-	{
-		case Loc_movement_backwards:
-			loc_ptr->pulse_count++; break;
-		case Loc_movement_forward:
-			loc_ptr->pulse_count--; break;
-		case Loc_movement_stop:
-			break;
-	}
+	loc_ptr->pulse_count += pulses;
 }
 
 /* void Localization_update_position(Localization_t *loc_ptr)
  *  Description:
- *   - convert the pulse count of the motor to a distance and center it
- *   - save the result to the localization reference
+ *   - convert the pulse count of the motor to a distance in um and center it (integer arithmetic only)
+ *   - save the result to the localization reference, the mm position truncates the absolute distance like before
+ *   - LOC_POSITION_FINE_UPDATED, if only the um position changed
  */
 int8_t Localization_update_position(Localization_t *loc_ptr)
 {
@@ -100,12 +95,18 @@ int8_t Localization_update_position(Localization_t *loc_ptr)
 	{
 		return LOC_NOT_LOCALIZED;
 	}
-	uint16_t absolute_distance = Localization_pulse_count_to_distance(*loc_ptr);
-	int16_t new_pos_mm = absolute_distance - loc_ptr->end_pos_mm;
-	if (new_pos_mm == loc_ptr->current_pos_mm)
+	int32_t absolute_distance_um = Localization_pulse_count_to_distance_um(*loc_ptr);
+	int32_t new_pos_um = absolute_distance_um - loc_ptr->end_pos_mm * LOC_UM_PER_MM;
+	if (new_pos_um == loc_ptr->current_pos_um)
 	{
 		return LOC_POSITION_RETAINED;
 	}
+	loc_ptr->current_pos_um = new_pos_um;
+	int16_t new_pos_mm = (int16_t) (absolute_distance_um / LOC_UM_PER_MM - loc_ptr->end_pos_mm);
+	if (new_pos_mm == loc_ptr->current_pos_mm)
+	{
+		return LOC_POSITION_FINE_UPDATED;
+	}
 	loc_ptr->current_pos_mm = new_pos_mm;
 	return LOC_POSITION_UPDATED;
 }
@@ -139,64 +140,29 @@ void Localization_serialize(Localization_t loc, uint8_t buffer[sizeof(Loc_safe_d
 	safe_data_ptr->end_pos_mm = loc.end_pos_mm;
 	safe_data_ptr->center_pos_mm = loc.center_pos_mm;
 	safe_data_ptr->start_pos_abs_mm = loc.start_pos_abs_mm;
+	safe_data_ptr->layout = LOC_SAFE_DATA_LAYOUT;
 	memcpy(buffer, safe_data_ptr, sizeof(Loc_safe_data_t));
 	free(safe_data_ptr);
 }
 
 void Localization_adapt_to_sensor(Localization_t *loc_ptr)
 {
-	loc_ptr->pulse_count = (int16_t) ((loc_ptr->current_measured_pos_mm + loc_ptr->end_pos_mm) / loc_ptr->distance_per_pulse);
+	int64_t absolute_distance_um_q16 = (int64_t) (loc_ptr->current_measured_pos_mm + loc_ptr->end_pos_mm) * LOC_UM_PER_MM * (1 << LOC_Q16_SHIFT);
+	loc_ptr->pulse_count = (int32_t) (absolute_distance_um_q16 / loc_ptr->distance_per_pulse_q16);
 	loc_ptr->current_pos_mm = loc_ptr->current_measured_pos_mm;
-}
-
-Loc_movement_t Localization_get_next_movement(Localization_t loc, int16_t desired_pos_mm)
-{
-	Loc_movement_t movement = Loc_movement_stop;
-	if (desired_pos_mm > (loc.current_pos_mm + loc.brake_path_mm))
-	{
-		movement = Loc_movement_backwards;
-	}
-	else if (desired_pos_mm < (loc.current_pos_mm - loc.brake_path_mm))
-	{
-		movement = Loc_movement_forward;
-	}
-	return movement;
-}
-
-void Localization_set_desired_pos_queued(Localization_t *loc_ptr, int16_t desired_pos_mm, Loc_movement_t new_movement)
-{
-	if (Localization_target_on_the_way(*loc_ptr, desired_pos_mm))
-	{
-		loc_ptr->desired_pos_mm = desired_pos_mm;
-		if (new_movement == loc_ptr->movement)
-		{
-			loc_ptr->desired_pos_queue = LOC_DESIRED_POS_QUEUE_EMPTY;
-		}
-	}
-	else
-	{
-		loc_ptr->desired_pos_queue = desired_pos_mm;
-	}
-}
-
-void Localization_progress_queue(Localization_t *loc_ptr)
-{
-	if (loc_ptr->desired_pos_queue != LOC_DESIRED_POS_QUEUE_EMPTY)
-	{
-		loc_ptr->desired_pos_mm = loc_ptr->desired_pos_queue;
-		loc_ptr->desired_pos_queue = LOC_DESIRED_POS_QUEUE_EMPTY;
-	}
+	loc_ptr->current_pos_um = loc_ptr->current_pos_mm * LOC_UM_PER_MM;
 }
 
 /* private function definitions -----------------------------------------------*/
 
-/* static int32_t Localization_pulse_count_to_distance(Localization_t loc)
+/* static int32_t Localization_pulse_count_to_distance_um(Localization_t loc)
  *  Description:
- *   - convert measured pulse count of the motor to a distance in mm, using distance per pulse parameter of the Linear guide
+ *   - convert measured pulse count of the motor to a distance in um, using distance per pulse parameter of the Linear guide
+ *   - one 32 x 32 -> 64 bit multiplication, the Q16.16 fraction is rounded down
  */
-static int16_t Localization_pulse_count_to_distance(Localization_t loc)
+static int32_t Localization_pulse_count_to_distance_um(Localization_t loc)
 {
-	return (int16_t) (loc.pulse_count * loc.distance_per_pulse);
+	return (int32_t) (((int64_t) loc.pulse_count * loc.distance_per_pulse_q16) >> LOC_Q16_SHIFT);
 }
 
 static int8_t Localization_deserialize(Localization_t *loc_ptr, uint8_t serial_buffer[sizeof(Loc_safe_data_t)])
@@ -208,15 +174,11 @@ static int8_t Localization_deserialize(Localization_t *loc_ptr, uint8_t serial_b
 	loc_ptr->end_pos_mm = safe_data_ptr->end_pos_mm;
 	loc_ptr->center_pos_mm = safe_data_ptr->center_pos_mm;
 	loc_ptr->start_pos_abs_mm = safe_data_ptr->start_pos_abs_mm;
+	uint8_t layout = safe_data_ptr->layout;
 	free(safe_data_ptr);
-	if (loc_ptr->state != Loc_state_5_center_pos_set)
+	if (layout != LOC_SAFE_DATA_LAYOUT || loc_ptr->state != Loc_state_5_center_pos_set)
 	{
 		return LOC_RECOVERY_RESET;
 	}
 	return LOC_RECOVERY_COMPLETE;
 }
-
-static boolean_t Localization_target_on_the_way(Localization_t loc, int16_t desired_pos_mm)
-{
-	return loc.movement == Loc_movement_stop || loc.movement == Localization_get_next_movement(loc, desired_pos_mm);
-}
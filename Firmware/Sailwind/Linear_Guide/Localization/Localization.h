@@ -10,15 +10,19 @@
 
 #include "boolean.h"
 #include <stdio.h>
+#include <stdint.h>
 
 /* defines ------------------------------------------------------------*/
 #define LOC_NOT_LOCALIZED 1
 #define LOC_POSITION_RETAINED 2
 #define LOC_POSITION_UPDATED 0
+#define LOC_POSITION_FINE_UPDATED 3 // moved by less than the mm resolution
 #define LOC_RECOVERY_RESET -1
 #define LOC_RECOVERY_COMPLETE 0
 #define LOC_RECOVERY_PARTIAL 1
-#define LOC_DESIRED_POS_QUEUE_EMPTY 32000
+#define LOC_Q16_SHIFT 16
+#define LOC_UM_PER_MM 1000
+#define LOC_SAFE_DATA_LAYOUT 2 // increment when Loc_safe_data_t changes, older data is not recovered
 
 /* typedefs -----------------------------------------------------------*/
 typedef enum {
@@ -41,29 +45,30 @@ typedef struct {
 	Loc_movement_t movement;
 	boolean_t is_localized;
 	boolean_t is_triggered;
-	float distance_per_pulse;
+	int32_t distance_per_pulse_q16; // um per pulse, Q16.16
 	uint16_t end_pos_mm;
 	uint16_t start_pos_abs_mm;
 	int16_t center_pos_mm;
+	int32_t current_pos_um;
 	int16_t current_pos_mm;
 	int16_t current_measured_pos_mm;
-	int16_t pulse_count;
+	int32_t pulse_count;
 	int16_t desired_pos_mm;
-	int16_t desired_pos_queue;
 	uint16_t brake_path_mm;
 	int8_t recovery_state;
 } Localization_t;
 
 typedef struct {
 	Loc_state_t state;
-	int16_t pulse_count;
+	int32_t pulse_count;
 	uint16_t end_pos_mm;
 	int16_t center_pos_mm;
 	uint16_t start_pos_abs_mm;
+	uint8_t layout;
 } Loc_safe_data_t;
 
 /* API function prototypes ---------------------------------------------------*/
-Localization_t Localization_init(float distance_per_pulse, uint8_t serial_buffer[sizeof(Loc_safe_data_t)]);
+Localization_t Localization_init(int32_t distance_per_pulse_q16, uint8_t serial_buffer[sizeof(Loc_safe_data_t)]);
 void Localization_reset(Localization_t *loc_ptr, boolean_t direct_trigger);
 void Localization_recover(Localization_t *loc_ptr, int8_t recovery_state, boolean_t direct_trigger);
 void Localization_set_endpos(Localization_t *loc_ptr);
@@ -71,11 +76,8 @@ void Localization_set_center(Localization_t *loc_ptr);
 void Localization_set_startpos_abs(Localization_t *loc_ptr, uint16_t measured_value);
 void Localization_parse_distance_sensor_value(Localization_t *loc_ptr, uint16_t measured_value);
 void Localization_adapt_to_sensor(Localization_t *loc_ptr);
-void Localization_callback_pulse_count(Localization_t *loc_ptr);
+void Localization_add_pulses(Localization_t *loc_ptr, int16_t pulses);
 int8_t Localization_update_position(Localization_t *loc_ptr);
 void Localization_serialize(Localization_t loc, uint8_t *serial_buffer);
-Loc_movement_t Localization_get_next_movement(Localization_t loc, int16_t desired_pos_mm);
-void Localization_set_desired_pos_queued(Localization_t *loc_ptr, int16_t desired_pos_mm, Loc_movement_t new_movement);
-void Localization_progress_queue(Localization_t *loc_ptr);
 
 #endif /* LOCALIZATION_LOCALIZATION_H_ */
@@ -0,0 +1,239 @@
+/**
+ * \file Motion_Planner.c
+ * @date 17 Oct 2026
+ * @brief Jerk-limited velocity profile of the linear guide, computed online every control cycle
+ */
+
+#include "Motion_Planner.h"
+#include <math.h>
+
+/* defines ------------------------------------------------------------*/
+#define MOTION_PLANNER_NUM_OF_JERKS 3
+
+/* private function prototypes -----------------------------------------------*/
+/**
+ * @brief distance to stop with the jerk and acceleration limits, in the direction of the velocity
+ * @param limits_ptr: limits of the profile
+ * @param velocity: current velocity, >= 0
+ * @param acceleration: current acceleration
+ * @retval distance in mm
+ */
+static float Motion_Planner_stop_distance(const Motion_Planner_limits_t *limits_ptr, float velocity, float acceleration);
+/**
+ * @brief choose the jerk of the next cycle to reach the target position
+ * @param planner_ptr: planner reference
+ * @retval none
+ */
+static void Motion_Planner_track_position(Motion_Planner_t *planner_ptr);
+/**
+ * @brief ramp the acceleration so that the velocity reaches the target velocity without overshoot
+ * @param planner_ptr: planner reference
+ * @param target_velocity: velocity to reach
+ * @retval none
+ */
+static void Motion_Planner_track_velocity(Motion_Planner_t *planner_ptr, float target_velocity);
+static float Motion_Planner_clamp(float value, float limit);
+
+/* API function definitions -----------------------------------------------*/
+Motion_Planner_t Motion_Planner_init(Motion_Planner_limits_t limits)
+{
+	Motion_Planner_t planner = {
+			.limits = limits,
+			.mode = Motion_Planner_mode_velocity,
+			.target_position = 0.0F,
+			.target_velocity = 0.0F,
+			.remaining_distance = 0.0F,
+			.is_distance_known = False,
+			.velocity = 0.0F,
+			.acceleration = 0.0F
+	};
+	return planner;
+}
+
+void Motion_Planner_set_target_position(Motion_Planner_t *planner_ptr, float position)
+{
+	if (planner_ptr->mode == Motion_Planner_mode_velocity)
+	{
+		/* the distance is taken from the measured position with the next update */
+		planner_ptr->is_distance_known = False;
+	}
+	else
+	{
+		planner_ptr->remaining_distance += position - planner_ptr->target_position;
+	}
+	planner_ptr->target_position = position;
+	planner_ptr->mode = Motion_Planner_mode_position;
+}
+
+void Motion_Planner_set_target_velocity(Motion_Planner_t *planner_ptr, float velocity)
+{
+	planner_ptr->mode = Motion_Planner_mode_velocity;
+	planner_ptr->target_velocity = velocity;
+}
+
+void Motion_Planner_stop_immediately(Motion_Planner_t *planner_ptr)
+{
+	Motion_Planner_set_target_velocity(planner_ptr, 0.0F);
+	planner_ptr->velocity = 0.0F;
+	planner_ptr->acceleration = 0.0F;
+}
+
+int8_t Motion_Planner_update(Motion_Planner_t *planner_ptr, float position)
+{
+	boolean_t was_at_rest = (boolean_t) (planner_ptr->velocity == 0.0F && planner_ptr->acceleration == 0.0F);
+	if (planner_ptr->mode == Motion_Planner_mode_velocity)
+	{
+		Motion_Planner_track_velocity(planner_ptr, Motion_Planner_clamp(planner_ptr->target_velocity, planner_ptr->limits.max_velocity));
+	}
+	else
+	{
+		if (was_at_rest || !planner_ptr->is_distance_known)
+		{
+			planner_ptr->remaining_distance = planner_ptr->target_position - position;
+			planner_ptr->is_distance_known = True;
+		}
+		/* a started movement follows the profile down to the target, the tolerance only prevents restarts */
+		if (!was_at_rest || fabsf(planner_ptr->remaining_distance) > planner_ptr->limits.position_tolerance)
+		{
+			Motion_Planner_track_position(planner_ptr);
+		}
+	}
+	if (planner_ptr->velocity != 0.0F || planner_ptr->acceleration != 0.0F)
+	{
+		return MOTION_PLANNER_MOVING;
+	}
+	return was_at_rest ? MOTION_PLANNER_IDLE : MOTION_PLANNER_STOPPED;
+}
+
+float Motion_Planner_get_stop_distance(const Motion_Planner_t *planner_ptr)
+{
+	if (planner_ptr->velocity < 0.0F)
+	{
+		return Motion_Planner_stop_distance(&planner_ptr->limits, -planner_ptr->velocity, -planner_ptr->acceleration);
+	}
+	return Motion_Planner_stop_distance(&planner_ptr->limits, planner_ptr->velocity, planner_ptr->acceleration);
+}
+
+/* private function definitions -----------------------------------------------*/
+
+/* static float Motion_Planner_stop_distance(const Motion_Planner_limits_t *limits_ptr, float velocity, float acceleration)
+ *  Description:
+ *   - phase 1: ramp the acceleration down to the peak deceleration, phase 2: hold it, phase 3: ramp it up to 0
+ *   - the peak deceleration is limited by the acceleration limit, without phase 2 if the velocity is too low to reach it
+ *   - if the velocity crosses 0 even when the deceleration is reduced at once, only the way to the crossing counts
+ */
+static float Motion_Planner_stop_distance(const Motion_Planner_limits_t *limits_ptr, float velocity, float acceleration)
+{
+	float jerk = limits_ptr->max_jerk;
+	float max_acceleration = limits_ptr->max_acceleration;
+	if (velocity <= 0.0F)
+	{
+		return 0.0F;
+	}
+	if (acceleration < 0.0F && velocity <= acceleration * acceleration / (2.0F * jerk))
+	{
+		float t = (-acceleration - sqrtf(acceleration * acceleration - 2.0F * jerk * velocity)) / jerk;
+		return velocity * t + acceleration * t * t / 2.0F + jerk * t * t * t / 6.0F;
+	}
+	float peak = sqrtf(jerk * velocity + acceleration * acceleration / 2.0F);
+	float t2 = 0.0F;
+	if (peak > max_acceleration)
+	{
+		peak = max_acceleration;
+		t2 = (velocity + acceleration * acceleration / (2.0F * jerk) - peak * peak / jerk) / peak;
+	}
+	float t1 = (acceleration + peak) / jerk;
+	float t3 = peak / jerk;
+	float distance = velocity * t1 + acceleration * t1 * t1 / 2.0F - jerk * t1 * t1 * t1 / 6.0F;
+	velocity += acceleration * t1 - jerk * t1 * t1 / 2.0F;
+	distance += velocity * t2 - peak * t2 * t2 / 2.0F;
+	velocity -= peak * t2;
+	return distance + velocity * t3 - peak * t3 * t3 / 2.0F + jerk * t3 * t3 * t3 / 6.0F;
+}
+
+/* static void Motion_Planner_track_position(Motion_Planner_t *planner_ptr)
+ *  Description:
+ *   - calculated in the direction of the target, a velocity away from the target is negative
+ *   - within the position tolerance in the direction of the movement, the final ramp is completed without reversing
+ *   - try full jerk, no jerk and full negative jerk in this order and take the first one
+ *     that keeps the velocity limit and still stops before the target
+ *   - a state below the final ramp of the deceleration (velocity < acceleration^2 / 2 jerk) cannot reach velocity 0
+ *     and acceleration 0 at the same time anymore, full jerk is kept instead (overshoot below 1 um)
+ *   - the state comes to rest when the velocity would cross 0 while braking or the final ramp is complete
+ */
+static void Motion_Planner_track_position(Motion_Planner_t *planner_ptr)
+{
+	const Motion_Planner_limits_t *limits_ptr = &planner_ptr->limits;
+	float dt = limits_ptr->cycle_time;
+	float jerk = limits_ptr->max_jerk;
+	float direction = planner_ptr->remaining_distance > 0.0F ? 1.0F : -1.0F;
+	if (planner_ptr->velocity != 0.0F && fabsf(planner_ptr->remaining_distance) <= limits_ptr->position_tolerance)
+	{
+		/* an overshoot within the tolerance does not reverse the movement */
+		direction = planner_ptr->velocity > 0.0F ? 1.0F : -1.0F;
+	}
+	float remaining = direction * planner_ptr->remaining_distance;
+	float velocity = direction * planner_ptr->velocity;
+	float acceleration = direction * planner_ptr->acceleration;
+	const float jerks[MOTION_PLANNER_NUM_OF_JERKS] = {jerk, 0.0F, -jerk};
+	float next_velocity = velocity;
+	float next_acceleration = acceleration;
+
+	for (uint8_t i = 0; i < MOTION_PLANNER_NUM_OF_JERKS; i++)
+	{
+		next_acceleration = Motion_Planner_clamp(acceleration + jerks[i] * dt, limits_ptr->max_acceleration);
+		next_velocity = velocity + (acceleration + next_acceleration) / 2.0F * dt;
+		if (i > 0 && next_acceleration < 0.0F && next_velocity < next_acceleration * next_acceleration / (2.0F * jerk))
+		{
+			next_acceleration = Motion_Planner_clamp(acceleration + jerks[0] * dt, limits_ptr->max_acceleration);
+			next_velocity = velocity + (acceleration + next_acceleration) / 2.0F * dt;
+			break;
+		}
+		boolean_t keeps_velocity_limit = (boolean_t) (next_acceleration > 0.0F
+				? next_velocity + next_acceleration * next_acceleration / (2.0F * jerk) <= limits_ptr->max_velocity
+				: next_velocity <= limits_ptr->max_velocity || next_acceleration < 0.0F);
+		float next_remaining = remaining - (velocity + next_velocity) / 2.0F * dt;
+		if (keeps_velocity_limit && Motion_Planner_stop_distance(limits_ptr, next_velocity, next_acceleration) <= next_remaining)
+		{
+			break;
+		}
+	}
+	if ((velocity > 0.0F && next_velocity <= 0.0F && next_acceleration <= 0.0F)
+			|| (acceleration < 0.0F && next_acceleration >= 0.0F && next_velocity <= jerk * dt * dt))
+	{
+		next_velocity = 0.0F;
+		next_acceleration = 0.0F;
+	}
+	planner_ptr->remaining_distance -= direction * (velocity + next_velocity) / 2.0F * dt;
+	planner_ptr->velocity = direction * next_velocity;
+	planner_ptr->acceleration = direction * next_acceleration;
+}
+
+/* static void Motion_Planner_track_velocity(Motion_Planner_t *planner_ptr, float target_velocity)
+ *  Description:
+ *   - the acceleration aims at sqrt(2 * jerk * velocity difference): reduced with the jerk limit
+ *     it reaches 0 exactly when the velocity reaches the target
+ */
+static void Motion_Planner_track_velocity(Motion_Planner_t *planner_ptr, float target_velocity)
+{
+	const Motion_Planner_limits_t *limits_ptr = &planner_ptr->limits;
+	float dt = limits_ptr->cycle_time;
+	float difference = target_velocity - planner_ptr->velocity;
+	float desired_acceleration = copysignf(fminf(limits_ptr->max_acceleration,
+			sqrtf(2.0F * limits_ptr->max_jerk * fabsf(difference))), difference);
+	float acceleration = planner_ptr->acceleration
+			+ Motion_Planner_clamp(desired_acceleration - planner_ptr->acceleration, limits_ptr->max_jerk * dt);
+	float velocity = planner_ptr->velocity + (planner_ptr->acceleration + acceleration) / 2.0F * dt;
+	if ((target_velocity - velocity) * difference <= 0.0F)
+	{
+		velocity = target_velocity;
+		acceleration = 0.0F;
+	}
+	planner_ptr->velocity = velocity;
+	planner_ptr->acceleration = acceleration;
+}
+
+static float Motion_Planner_clamp(float value, float limit)
+{
+	return fmaxf(-limit, fminf(limit, value));
+}
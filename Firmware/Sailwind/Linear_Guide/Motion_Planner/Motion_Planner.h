@@ -0,0 +1,120 @@
+/**
+ * \file Motion_Planner.h
+ * @date 17 Oct 2026
+ * @brief Jerk-limited velocity profile of the linear guide, computed online every control cycle
+ *
+ * In position mode the planner chooses every cycle the highest jerk that still allows to stop at the
+ * target (S-curve: the acceleration ramps with the jerk limit, saturates at the acceleration limit and
+ * the velocity at the velocity limit). The distance to the target is integrated open-loop from the
+ * planned velocity, the measured position (resolution of one motor pulse) is only taken when a movement
+ * starts and the position is only corrected after the profile has stopped: a deviation above the
+ * position tolerance starts a new movement from rest. The landing accuracy, and braking without a
+ * safety margin, therefore depend on the motor tracking the set point; a motor that lags behind
+ * lands short and is corrected by a second, short movement.
+ * The target can be changed at any time, the profile continues from the current state, also when
+ * the direction has to be reversed. In velocity mode the planner only ramps to the target velocity.
+ * Positions in mm, positive velocities move backwards (increasing position).
+ */
+
+#ifndef MOTION_PLANNER_MOTION_PLANNER_H_
+#define MOTION_PLANNER_MOTION_PLANNER_H_
+
+#include "boolean.h"
+#include <stdint.h>
+
+/* defines ------------------------------------------------------------*/
+#define MOTION_PLANNER_MOVING 0
+#define MOTION_PLANNER_STOPPED 1 // came to rest in this cycle
+#define MOTION_PLANNER_IDLE 2
+
+/* typedefs -----------------------------------------------------------*/
+typedef enum {
+	Motion_Planner_mode_velocity,
+	Motion_Planner_mode_position
+} Motion_Planner_mode_t;
+
+/** @struct Motion_Planner_limits_t
+ *  @brief limits of the profile
+ *  @var Motion_Planner_limits_t::max_velocity
+ *  mm/s, may be changed while moving
+ *  @var Motion_Planner_limits_t::max_acceleration
+ *  mm/s^2
+ *  @var Motion_Planner_limits_t::max_jerk
+ *  mm/s^3
+ *  @var Motion_Planner_limits_t::position_tolerance
+ *  mm, a target within the tolerance is reached and does not start a movement
+ *  @var Motion_Planner_limits_t::cycle_time
+ *  s, period of Motion_Planner_update
+ */
+typedef struct {
+	float max_velocity;
+	float max_acceleration;
+	float max_jerk;
+	float position_tolerance;
+	float cycle_time;
+} Motion_Planner_limits_t;
+
+/** @struct Motion_Planner_t
+ *  @brief state of the planner
+ *  @var Motion_Planner_t::remaining_distance
+ *  planned distance to the target position in mm, integrated open-loop from the planned velocity
+ *  @var Motion_Planner_t::is_distance_known
+ *  False until the distance is taken from the measured position after switching to position mode
+ *  @var Motion_Planner_t::velocity
+ *  planned velocity in mm/s, set point of the motor
+ *  @var Motion_Planner_t::acceleration
+ *  planned acceleration in mm/s^2
+ */
+typedef struct {
+	Motion_Planner_limits_t limits;
+	Motion_Planner_mode_t mode;
+	float target_position;
+	float target_velocity;
+	float remaining_distance;
+	boolean_t is_distance_known;
+	float velocity;
+	float acceleration;
+} Motion_Planner_t;
+
+/* API function prototypes -----------------------------------------------*/
+/**
+ * @brief initialise a planner at rest
+ * @param limits: limits of the profile
+ * @retval planner
+ */
+Motion_Planner_t Motion_Planner_init(Motion_Planner_limits_t limits);
+/**
+ * @brief move to a position and stop there (position mode), a movement continues to the new target
+ * @param planner_ptr: planner reference
+ * @param position: target in mm
+ * @retval none
+ */
+void Motion_Planner_set_target_position(Motion_Planner_t *planner_ptr, float position);
+/**
+ * @brief ramp to a velocity, 0 stops with the limits of the planner (velocity mode)
+ * @param planner_ptr: planner reference
+ * @param velocity: target in mm/s, limited to max_velocity
+ * @retval none
+ */
+void Motion_Planner_set_target_velocity(Motion_Planner_t *planner_ptr, float velocity);
+/**
+ * @brief set velocity and acceleration to 0 without a profile (emergency and endswitch stop)
+ * @param planner_ptr: planner reference
+ * @retval none
+ */
+void Motion_Planner_stop_immediately(Motion_Planner_t *planner_ptr);
+/**
+ * @brief compute the velocity of the next cycle (to be called every cycle_time)
+ * @param planner_ptr: planner reference
+ * @param position: measured position in mm, only used in position mode when the planner is at rest
+ * @retval MOTION_PLANNER_MOVING, MOTION_PLANNER_STOPPED or MOTION_PLANNER_IDLE
+ */
+int8_t Motion_Planner_update(Motion_Planner_t *planner_ptr, float position);
+/**
+ * @brief get the distance the planner needs to stop from the current velocity and acceleration
+ * @param planner_ptr: planner reference
+ * @retval distance in mm
+ */
+float Motion_Planner_get_stop_distance(const Motion_Planner_t *planner_ptr);
+
+#endif /* MOTION_PLANNER_MOTION_PLANNER_H_ */
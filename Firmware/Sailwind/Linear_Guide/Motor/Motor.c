@@ -36,68 +36,38 @@ Motor_t Motor_init(DAC_HandleTypeDef *hdac_ptr) {
 			.OUT3_rot_dir = IO_digital_Pin_init(OUT_3_GPIO_Port, OUT_3_Pin),
 			.rpm_set_point = 0,
 			.normal_rpm = Motor_read_max_speed(),
-			.ramp_final_rpm = 0,
-			.ramp_activated = False
+			.rotation = Motor_function_stop
 	};
 	return motor;
 }
-/* void motor_start_moving(Motor_t *motor_ptr, motor_moving_state_t direction)
+/* void Motor_set_velocity(Motor_t *motor_ptr, int16_t velocity_rpm)
  *  Description:
- *   - write digital motor Inputs to start motor movement in desired direction (motor_moving_state_rechtslauf / ...linkslauf)
+ *   - set point of the motion planner, called every control cycle
+ *   - positive values rotate clockwise (backwards), negative values counter clockwise (forward), 0 stops
+ *   - the INs and the DAC are only written when the rotation or the rpm value changes
  */
-void Motor_start_moving(Motor_t *motor_ptr, Motor_function_t direction) {
-	printf("motor start moving\r\n");
-	Motor_set_function(motor_ptr, direction);
-	motor_ptr->ramp_final_rpm = motor_ptr->normal_rpm;
-	motor_ptr->ramp_activated = True;
-}
-/* void motor_stop_moving(Motor_t *motor_ptr)
- *  Description:
- *   - write digital motor Inputs to stop the motor
- *   - save the new moving state to the motor reference
- */
-void Motor_stop_moving(Motor_t *motor_ptr, boolean_t immediate) {
-	printf("motor stop moving\r\n");
-	if (immediate)
-	{
-		Motor_set_rpm(motor_ptr, 0);
-	}
-	else
-	{
-		motor_ptr->ramp_final_rpm = 0;
-		motor_ptr->ramp_activated = True;
-	}
-}
-
-int8_t Motor_speed_ramp(Motor_t *motor_ptr)
+void Motor_set_velocity(Motor_t *motor_ptr, int16_t velocity_rpm)
 {
-	if (!motor_ptr->ramp_activated)
-	{
-		return MOTOR_RAMP_INACTIVE;
-	}
-	if (abs(motor_ptr->rpm_set_point - motor_ptr->ramp_final_rpm) < MOTOR_RAMP_STEP_RPM)
+	if (velocity_rpm == 0)
 	{
-		Motor_set_rpm(motor_ptr, motor_ptr->ramp_final_rpm);
-		motor_ptr->ramp_activated = False;
-		if (motor_ptr->rpm_set_point == 0)
+		if (motor_ptr->rpm_set_point != 0)
 		{
-			return MOTOR_RAMP_STOPPED;
+			Motor_set_rpm(motor_ptr, 0);
 		}
-		return MOTOR_RAMP_NORMAL_SPEED;
+		motor_ptr->rotation = Motor_function_stop;
+		return;
 	}
-	if ((HAL_GetTick()-motor_ptr->ramp_last_step_ms) < MOTOR_RAMP_STEP_MS)
+	Motor_function_t rotation = velocity_rpm > 0 ? Motor_function_cw_rotation : Motor_function_ccw_rotation;
+	if (rotation != motor_ptr->rotation)
 	{
-		return MOTOR_RAMP_WAIT;
+		Motor_set_function(motor_ptr, rotation);
+		motor_ptr->rotation = rotation;
+	}
+	uint16_t rpm_value = (uint16_t) abs(velocity_rpm);
+	if (rpm_value != motor_ptr->rpm_set_point)
+	{
+		Motor_set_rpm(motor_ptr, rpm_value);
 	}
-	int8_t sign = motor_ptr->ramp_final_rpm == 0 ? -1 : 1;
-	Motor_set_rpm(motor_ptr, motor_ptr->rpm_set_point + sign * MOTOR_RAMP_STEP_RPM);
-	motor_ptr->ramp_last_step_ms = HAL_GetTick();
-	return MOTOR_RAMP_NEXT_STEP;
-}
-
-boolean_t Motor_is_currently_braking(Motor_t motor)
-{
-	return motor.ramp_activated && motor.ramp_final_rpm == 0;
 }
 
 /* void motor_set_function(Motor_t *motor_ptr, motor_function_t function)
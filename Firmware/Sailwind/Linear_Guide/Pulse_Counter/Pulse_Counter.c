@@ -0,0 +1,38 @@
+/**
+ * \file Pulse_Counter.c
+ * @date 17 Oct 2026
+ * @brief Counting of the motor pulses in hardware without an interrupt per pulse
+ */
+
+#include "Pulse_Counter.h"
+#include "Motor.h"
+
+/* private global variables -----------------------------------------------*/
+/* destination of the capture transfers, only the number of transfers is used */
+static uint16_t Pulse_Counter_dummy_capture = 0;
+
+/* API function definitions --------------------------------------------------*/
+Pulse_Counter_t Pulse_Counter_init(TIM_HandleTypeDef *htim_ptr, IO_digitalPin_t *rot_dir_ptr)
+{
+	Pulse_Counter_t counter = {
+			.htim_ptr = htim_ptr,
+			.rot_dir_ptr = rot_dir_ptr,
+			.last_remaining = PULSE_COUNTER_DMA_LENGTH
+	};
+	HAL_TIM_IC_Start_DMA(htim_ptr, TIM_CHANNEL_4, (uint32_t*) &Pulse_Counter_dummy_capture, PULSE_COUNTER_DMA_LENGTH);
+	return counter;
+}
+
+int16_t Pulse_Counter_update(Pulse_Counter_t *counter_ptr)
+{
+	uint16_t remaining = (uint16_t) __HAL_DMA_GET_COUNTER(counter_ptr->htim_ptr->hdma[TIM_DMA_ID_CC4]);
+	/* the stream counts down and reloads after the last transfer (circular mode) */
+	uint16_t pulses = (uint16_t) ((counter_ptr->last_remaining + PULSE_COUNTER_DMA_LENGTH - remaining) % PULSE_COUNTER_DMA_LENGTH);
+	counter_ptr->last_remaining = remaining;
+	/* the motor reports the actual direction, so pulses while coasting are counted as well */
+	if (IO_digitalRead(counter_ptr->rot_dir_ptr) == MOTOR_DIRECTION_CW)
+	{
+		return (int16_t) pulses;
+	}
+	return (int16_t) -pulses;
+}
@@ -0,0 +1,51 @@
+/**
+ * \file Pulse_Counter.h
+ * @date 17 Oct 2026
+ * @brief Counting of the motor pulses in hardware without an interrupt per pulse
+ *
+ * The pulse output of the motor (OUT_1) is only connected to channel 4 of TIM8, which cannot
+ * clock a timer counter. Every rising edge is captured instead and the capture requests a DMA
+ * transfer of a circular stream, the remaining number of transfers of the stream counts the pulses.
+ * The direction is taken from the rotation direction output of the motor (OUT_3).
+ */
+
+#ifndef PULSE_COUNTER_PULSE_COUNTER_H_
+#define PULSE_COUNTER_PULSE_COUNTER_H_
+
+#include "IO.h"
+
+/* defines ------------------------------------------------------------*/
+#define PULSE_COUNTER_DMA_LENGTH 0xFFFFU
+
+/* typedefs -----------------------------------------------------------*/
+/** @struct Pulse_Counter_t
+ *  @brief hardware pulse counter
+ *  @var Pulse_Counter_t::htim_ptr
+ *  timer with the capture channel of the pulse signal
+ *  @var Pulse_Counter_t::rot_dir_ptr
+ *  rotation direction output of the motor
+ *  @var Pulse_Counter_t::last_remaining
+ *  remaining transfers of the DMA stream at the last update
+ */
+typedef struct {
+	TIM_HandleTypeDef *htim_ptr;
+	IO_digitalPin_t *rot_dir_ptr;
+	uint16_t last_remaining;
+} Pulse_Counter_t;
+
+/* API function prototypes -----------------------------------------------*/
+/**
+ * @brief start counting the rising edges of the pulse signal
+ * @param htim_ptr: timer with the pulse signal on channel 4, the DMA request of the channel has to be linked
+ * @param rot_dir_ptr: rotation direction output of the motor
+ * @retval pulse counter
+ */
+Pulse_Counter_t Pulse_Counter_init(TIM_HandleTypeDef *htim_ptr, IO_digitalPin_t *rot_dir_ptr);
+/**
+ * @brief get the pulses counted since the last call (to be called at least every 32767 pulses)
+ * @param counter_ptr: pulse counter reference
+ * @retval pulses, positive for clockwise rotation (backwards movement)
+ */
+int16_t Pulse_Counter_update(Pulse_Counter_t *counter_ptr);
+
+#endif /* PULSE_COUNTER_PULSE_COUNTER_H_ */
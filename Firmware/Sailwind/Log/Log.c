@@ -0,0 +1,78 @@
+/**
+ * \file Log.c
+ * @date 17 Oct 2026
+ * @brief Buffered debug output, printf does not wait for the UART
+ */
+#include <stddef.h>
+#include "Log.h"
+
+/* defines -----------------------------------------------------------*/
+#define LOG_BUFFER_MASK (LOG_BUFFER_SIZE - 1U)
+
+/* private global variables -----------------------------------------------*/
+static UART_HandleTypeDef *Log_huart_ptr = NULL;
+static uint8_t Log_buffer[LOG_BUFFER_SIZE];
+static volatile uint32_t Log_head = 0U;       /* written by the producers with interrupts disabled */
+static volatile uint32_t Log_tail = 0U;       /* written by Log_update only */
+static uint32_t Log_transfer_size = 0U;       /* characters of the running transfer */
+static volatile uint32_t Log_num_of_dropped = 0U;
+
+/* API function definitions -----------------------------------------------*/
+
+void Log_init(UART_HandleTypeDef *huart_ptr) {
+  Log_head = 0U;
+  Log_tail = 0U;
+  Log_transfer_size = 0U;
+  Log_num_of_dropped = 0U;
+  Log_huart_ptr = huart_ptr;
+}
+
+void Log_putchar(UART_HandleTypeDef *huart_ptr, char ch) {
+  uint32_t primask;
+
+  if (Log_huart_ptr == NULL) {
+    HAL_UART_Transmit(huart_ptr, (uint8_t*) &ch, 1U, LOG_BLOCKING_TIMEOUT);
+    return;
+  }
+  /* printf is called from the main loop and from interrupts, the slot is claimed atomically */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (Log_head - Log_tail < LOG_BUFFER_SIZE) {
+    Log_buffer[Log_head & LOG_BUFFER_MASK] = (uint8_t) ch;
+    Log_head++;
+  } else {
+    Log_num_of_dropped++;
+  }
+  __set_PRIMASK(primask);
+}
+
+void Log_update(void) {
+  uint32_t tail;
+  uint32_t size;
+
+  if (Log_huart_ptr == NULL || Log_huart_ptr->gState != HAL_UART_STATE_READY) {
+    return;
+  }
+  /* the characters of the finished transfer are released only now */
+  Log_tail += Log_transfer_size;
+  Log_transfer_size = 0U;
+  tail = Log_tail;
+  size = Log_head - tail;
+  if (size == 0U) {
+    return;
+  }
+  /* one contiguous piece, the rest follows with the next transfer */
+  if (size > LOG_BUFFER_SIZE - (tail & LOG_BUFFER_MASK)) {
+    size = LOG_BUFFER_SIZE - (tail & LOG_BUFFER_MASK);
+  }
+  if (size > LOG_MAX_TRANSFER_SIZE) {
+    size = LOG_MAX_TRANSFER_SIZE;
+  }
+  if (HAL_UART_Transmit_IT(Log_huart_ptr, &Log_buffer[tail & LOG_BUFFER_MASK], (uint16_t) size) == HAL_OK) {
+    Log_transfer_size = size;
+  }
+}
+
+uint32_t Log_get_num_of_dropped(void) {
+  return Log_num_of_dropped;
+}
@@ -0,0 +1,53 @@
+/**
+ * \file Log.h
+ * @date 17 Oct 2026
+ * @brief Buffered debug output, printf does not wait for the UART
+ *
+ * Until Log_init the characters are sent blocking like before. Afterwards they are written
+ * into a ring buffer from any context and the background task Log_update hands the buffer
+ * to the UART interrupt transfer. Characters are dropped while the buffer is full.
+ */
+
+#ifndef LOG_LOG_H_
+#define LOG_LOG_H_
+
+#include <stdint.h>
+#include "stm32f4xx_hal.h"
+
+/* defines -----------------------------------------------------------*/
+#define LOG_BUFFER_SIZE       1024U   /* power of two */
+#define LOG_MAX_TRANSFER_SIZE 64U
+#define LOG_BLOCKING_TIMEOUT  0xFFFFU
+
+/* API function prototypes -----------------------------------------------*/
+
+/**
+ * @brief switch from blocking to buffered output
+ * @param huart_ptr: UART of the debug output, its interrupt has to be enabled
+ * @retval none
+ */
+void Log_init(UART_HandleTypeDef *huart_ptr);
+
+/**
+ * @brief output a character (to be called by __io_putchar)
+ * @param huart_ptr: UART of the debug output
+ * @param ch: character
+ * @retval none
+ */
+void Log_putchar(UART_HandleTypeDef *huart_ptr, char ch);
+
+/**
+ * @brief start the next transfer when the UART is idle (to be called in the main loop)
+ * @param none
+ * @retval none
+ */
+void Log_update(void);
+
+/**
+ * @brief get the number of characters dropped because the buffer was full
+ * @param none
+ * @retval number of dropped characters
+ */
+uint32_t Log_get_num_of_dropped(void);
+
+#endif /* LOG_LOG_H_ */
@@ -7,6 +7,7 @@
 
 #include "Manual_Control.h"
 #include "boolean.h"
+#include <stdlib.h>
 #include "FRAM.h"
 #include "FRAM_memory_mapping.h"
 
@@ -93,8 +94,7 @@ void Manual_Control_poll(Manual_Control_t *mc_ptr)
  *   		-> set state to 3 (approach center)
  *   		-> calculate range of linear guide
  *   		-> start motor moving to the calculated center
- *   - state 3 waits until center is reached
- *   		-> motor is stopped
+ *   - state 3 waits until the motion planner stopped at the center
  *   		-> state is set to state 4 (set center)
  *   - state 4 waits for second button press to confirm or update the center pos
  *   		-> Localization process finished: ready for automatic mode
@@ -150,14 +150,14 @@ int8_t Manual_Control_Localization(Manual_Control_t *mc_ptr)
 			Linear_Guide_move(lg_ptr, Loc_movement_stop, True);
 			HAL_Delay(1000);
 			Localization_set_endpos(loc_ptr);
-			printf("pulses:%d\r\n", loc_ptr->pulse_count);
+			printf("pulses:%ld\r\n", loc_ptr->pulse_count);
 			printf("endpos:%d\r\n", loc_ptr->end_pos_mm);
 			*state = Loc_state_3_approach_center;
 			loc_ptr->desired_pos_mm = 0;
 			printf("new state approach center\r\n");
 			break;
 		case Loc_state_3_approach_center:
-			if(loc_ptr->current_pos_mm != 0)
+			if(loc_ptr->movement != Loc_movement_stop || abs(loc_ptr->current_pos_mm) > 1)
 			{
 				break;
 			}
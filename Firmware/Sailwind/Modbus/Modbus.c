@@ -0,0 +1,394 @@
+/**
+ * \file Modbus.c
+ * @date 17 Oct 2026
+ * @brief Modbus TCP application protocol with the register map of the linear guide
+ */
+#include <string.h>
+#include "Modbus.h"
+#include "Telemetry.h"
+#include "Linear_Guide.h"
+#include "Command.h"
+
+/* defines -----------------------------------------------------------*/
+#define MODBUS_MAX_READ_QUANTITY   125U
+#define MODBUS_MAX_WRITE_QUANTITY  123U
+#define MODBUS_MAX_SAIL_POS        100
+#define MODBUS_MIN_RPM             400U
+#define MODBUS_MAX_RPM             2000U
+#define MODBUS_MIN_DISTANCE_ERROR  5U
+#define MODBUS_MAX_DISTANCE_ERROR  50U
+
+/* offsets in the frame */
+#define MODBUS_LENGTH              4U
+#define MODBUS_FUNCTION            7U
+#define MODBUS_ADDRESS             8U
+#define MODBUS_QUANTITY            10U
+#define MODBUS_VALUE               10U
+#define MODBUS_BYTE_COUNT          12U
+#define MODBUS_VALUES              13U
+
+/* private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief answer a read of input or holding registers
+ * @param request: ptr to the request frame
+ * @param length: length of the request frame
+ * @param response: ptr to the response frame
+ * @retval length of the PDU or 0 if an exception is set in the response
+ */
+static size_t Modbus_read_registers(const uint8_t *request, size_t length, uint8_t *response);
+
+/**
+ * @brief answer a write of a single holding register
+ * @param request: ptr to the request frame
+ * @param length: length of the request frame
+ * @param response: ptr to the response frame
+ * @retval length of the PDU or 0 if an exception is set in the response
+ */
+static size_t Modbus_write_single_register(const uint8_t *request, size_t length, uint8_t *response);
+
+/**
+ * @brief answer a write of several holding registers, they are applied only if every value is valid and queued
+ * @param request: ptr to the request frame
+ * @param length: length of the request frame
+ * @param response: ptr to the response frame
+ * @retval length of the PDU or 0 if an exception is set in the response
+ */
+static size_t Modbus_write_multiple_registers(const uint8_t *request, size_t length, uint8_t *response);
+
+/**
+ * @brief read an input register
+ * @param snapshot_ptr: ptr to the telemetry snapshot
+ * @param address: Modbus_input_register_t
+ * @retval value of the register
+ */
+static uint16_t Modbus_get_input_register(const Telemetry_snapshot_t *snapshot_ptr, uint16_t address);
+
+/**
+ * @brief read a holding register
+ * @param snapshot_ptr: ptr to the telemetry snapshot
+ * @param address: Modbus_holding_register_t
+ * @retval value of the register
+ */
+static uint16_t Modbus_get_holding_register(const Telemetry_snapshot_t *snapshot_ptr, uint16_t address);
+
+/**
+ * @brief check a holding register value and add it to the command group of the request
+ * @param address: Modbus_holding_register_t
+ * @param value: value of the register
+ * @param apply: queue the value if it is valid
+ * @retval 0 or the exception code
+ */
+static uint8_t Modbus_set_holding_register(uint16_t address, uint16_t value, boolean_t apply);
+
+/**
+ * @brief build an exception response
+ * @param response: ptr to the response frame
+ * @param exception: MODBUS_x exception code
+ * @retval 0
+ */
+static size_t Modbus_set_exception(uint8_t *response, uint8_t exception);
+
+static uint16_t Modbus_saturate(uint32_t value);
+
+static uint16_t Modbus_get_u16(const uint8_t *buffer);
+
+static void Modbus_put_u16(uint8_t *buffer, uint16_t value);
+
+/* API function definitions -----------------------------------------------*/
+
+int8_t Modbus_check_frame(const uint8_t *buffer, size_t length, size_t *frame_length_ptr) {
+  uint16_t mbap_length;
+
+  *frame_length_ptr = 0U;
+  if (length < MODBUS_MBAP_SIZE) {
+    return MODBUS_FRAME_INCOMPLETE;
+  }
+  /* the length counts the unit id and at least the function code */
+  mbap_length = Modbus_get_u16(&buffer[MODBUS_LENGTH]);
+  if (Modbus_get_u16(&buffer[2]) != MODBUS_PROTOCOL_ID || mbap_length < 2U || mbap_length > MODBUS_MAX_PDU_SIZE + 1U) {
+    return MODBUS_FRAME_INVALID;
+  }
+  *frame_length_ptr = MODBUS_MBAP_SIZE - 1U + mbap_length;
+  return (length < *frame_length_ptr) ? MODBUS_FRAME_INCOMPLETE : MODBUS_FRAME_COMPLETE;
+}
+
+size_t Modbus_handle(const uint8_t *request, size_t length, uint8_t *response) {
+  size_t pdu_length;
+
+  /* transaction id, protocol id and unit id are echoed */
+  memcpy(response, request, MODBUS_MBAP_SIZE);
+  response[MODBUS_FUNCTION] = request[MODBUS_FUNCTION];
+
+  switch (request[MODBUS_FUNCTION]) {
+    case MODBUS_READ_HOLDING_REGISTERS:
+    case MODBUS_READ_INPUT_REGISTERS:
+      pdu_length = Modbus_read_registers(request, length, response);
+      break;
+    case MODBUS_WRITE_SINGLE_REGISTER:
+      pdu_length = Modbus_write_single_register(request, length, response);
+      break;
+    case MODBUS_WRITE_MULTIPLE_REGISTERS:
+      pdu_length = Modbus_write_multiple_registers(request, length, response);
+      break;
+    default:
+      pdu_length = Modbus_set_exception(response, MODBUS_ILLEGAL_FUNCTION);
+      break;
+  }
+  if (pdu_length == 0U) {
+    /* function code and exception code */
+    pdu_length = 2U;
+  }
+  Modbus_put_u16(&response[MODBUS_LENGTH], (uint16_t) (pdu_length + 1U));
+  return MODBUS_MBAP_SIZE + pdu_length;
+}
+
+/* private function definitions -----------------------------------------------*/
+
+static size_t Modbus_read_registers(const uint8_t *request, size_t length, uint8_t *response) {
+  Telemetry_snapshot_t snapshot;
+  uint16_t address;
+  uint16_t quantity;
+  uint16_t num_of_registers = (request[MODBUS_FUNCTION] == MODBUS_READ_INPUT_REGISTERS) ?
+      Modbus_num_of_input_registers : Modbus_num_of_holding_registers;
+
+  if (length != MODBUS_QUANTITY + 2U) {
+    return Modbus_set_exception(response, MODBUS_ILLEGAL_DATA_VALUE);
+  }
+  address = Modbus_get_u16(&request[MODBUS_ADDRESS]);
+  quantity = Modbus_get_u16(&request[MODBUS_QUANTITY]);
+  if (quantity == 0U || quantity > MODBUS_MAX_READ_QUANTITY) {
+    return Modbus_set_exception(response, MODBUS_ILLEGAL_DATA_VALUE);
+  }
+  if ((uint32_t) address + quantity > num_of_registers) {
+    return Modbus_set_exception(response, MODBUS_ILLEGAL_DATA_ADDRESS);
+  }
+  /* all registers of one response belong to the same cycle */
+  Telemetry_get_snapshot(&snapshot);
+  response[MODBUS_ADDRESS] = (uint8_t) (2U * quantity);
+  for (uint16_t i = 0U; i < quantity; i++) {
+    Modbus_put_u16(&response[MODBUS_ADDRESS + 1U + 2U * i],
+                   (request[MODBUS_FUNCTION] == MODBUS_READ_INPUT_REGISTERS) ?
+                       Modbus_get_input_register(&snapshot, address + i) :
+                       Modbus_get_holding_register(&snapshot, address + i));
+  }
+  /* function code, byte count and values */
+  return 2U + 2U * quantity;
+}
+
+static size_t Modbus_write_single_register(const uint8_t *request, size_t length, uint8_t *response) {
+  uint16_t address;
+  uint8_t exception;
+
+  if (length != MODBUS_VALUE + 2U) {
+    return Modbus_set_exception(response, MODBUS_ILLEGAL_DATA_VALUE);
+  }
+  address = Modbus_get_u16(&request[MODBUS_ADDRESS]);
+  if (address >= Modbus_num_of_holding_registers) {
+    return Modbus_set_exception(response, MODBUS_ILLEGAL_DATA_ADDRESS);
+  }
+  Command_begin();
+  exception = Modbus_set_holding_register(address, Modbus_get_u16(&request[MODBUS_VALUE]), True);
+  if (exception != 0U) {
+    return Modbus_set_exception(response, exception);
+  }
+  Command_commit();
+  /* the response echoes address and value */
+  memcpy(&response[MODBUS_ADDRESS], &request[MODBUS_ADDRESS], 4U);
+  return 5U;
+}
+
+static size_t Modbus_write_multiple_registers(const uint8_t *request, size_t length, uint8_t *response) {
+  uint16_t address;
+  uint16_t quantity;
+  uint8_t exception;
+
+  if (length < MODBUS_VALUES) {
+    return Modbus_set_exception(response, MODBUS_ILLEGAL_DATA_VALUE);
+  }
+  address = Modbus_get_u16(&request[MODBUS_ADDRESS]);
+  quantity = Modbus_get_u16(&request[MODBUS_QUANTITY]);
+  if (quantity == 0U || quantity > MODBUS_MAX_WRITE_QUANTITY || request[MODBUS_BYTE_COUNT] != 2U * quantity
+      || length != MODBUS_VALUES + 2U * quantity) {
+    return Modbus_set_exception(response, MODBUS_ILLEGAL_DATA_VALUE);
+  }
+  if ((uint32_t) address + quantity > Modbus_num_of_holding_registers) {
+    return Modbus_set_exception(response, MODBUS_ILLEGAL_DATA_ADDRESS);
+  }
+  /* every value has to be valid before the first one is applied */
+  for (uint16_t i = 0U; i < quantity; i++) {
+    exception = Modbus_set_holding_register(address + i, Modbus_get_u16(&request[MODBUS_VALUES + 2U * i]), False);
+    if (exception != 0U) {
+      return Modbus_set_exception(response, exception);
+    }
+  }
+  /* the values are handed to the control task together or not at all */
+  Command_begin();
+  for (uint16_t i = 0U; i < quantity; i++) {
+    exception = Modbus_set_holding_register(address + i, Modbus_get_u16(&request[MODBUS_VALUES + 2U * i]), True);
+    if (exception != 0U) {
+      return Modbus_set_exception(response, exception);
+    }
+  }
+  Command_commit();
+  /* the response echoes address and quantity */
+  memcpy(&response[MODBUS_ADDRESS], &request[MODBUS_ADDRESS], 4U);
+  return 5U;
+}
+
+static uint16_t Modbus_get_input_register(const Telemetry_snapshot_t *snapshot_ptr, uint16_t address) {
+  switch ((Modbus_input_register_t) address) {
+    case Modbus_input_error_state:
+      return (uint16_t) snapshot_ptr->error_state;
+    case Modbus_input_operating_mode:
+      return (uint16_t) snapshot_ptr->operating_mode;
+    case Modbus_input_sail_adjustment_mode:
+      return (uint16_t) (int16_t) snapshot_ptr->sail_adjustment_mode;
+    case Modbus_input_is_localized:
+      return (uint16_t) snapshot_ptr->is_localized;
+    case Modbus_input_sail_pos:
+      return (uint16_t) (int16_t) snapshot_ptr->roll_pitch_percentage;
+    case Modbus_input_current_pos_mm:
+      return (uint16_t) snapshot_ptr->current_pos_mm;
+    case Modbus_input_measured_pos_mm:
+      return (uint16_t) snapshot_ptr->measured_pos_mm;
+    case Modbus_input_desired_pos_mm:
+      return (uint16_t) snapshot_ptr->desired_pos_mm;
+    case Modbus_input_rpm_set_point:
+      return snapshot_ptr->rpm_set_point;
+    case Modbus_input_movement:
+      return (uint16_t) snapshot_ptr->movement;
+    case Modbus_input_endswitches:
+      return (uint16_t) (((snapshot_ptr->is_front_endswitch_detected == True) ? 0x01U : 0U)
+          | ((snapshot_ptr->is_back_endswitch_detected == True) ? 0x02U : 0U));
+    case Modbus_input_current_mA:
+      return snapshot_ptr->current_mA;
+    case Modbus_input_wind_speed_x100:
+      return Modbus_saturate(snapshot_ptr->wind_sample.speed_x100);
+    case Modbus_input_wind_direction_x10:
+      return snapshot_ptr->wind_sample.direction_x10;
+    case Modbus_input_short_mean_speed_x100:
+      return Modbus_saturate(snapshot_ptr->wind_statistics[Wind_History_window_short].mean_speed_x100);
+    case Modbus_input_short_max_speed_x100:
+      return Modbus_saturate(snapshot_ptr->wind_statistics[Wind_History_window_short].max_speed_x100);
+    case Modbus_input_long_mean_speed_x100:
+      return Modbus_saturate(snapshot_ptr->wind_statistics[Wind_History_window_long].mean_speed_x100);
+    case Modbus_input_long_max_speed_x100:
+      return Modbus_saturate(snapshot_ptr->wind_statistics[Wind_History_window_long].max_speed_x100);
+    case Modbus_input_gust_active:
+      return (uint16_t) snapshot_ptr->gust.is_active;
+    case Modbus_input_gust_count:
+      return Modbus_saturate(snapshot_ptr->gust.count);
+    case Modbus_input_localization_state:
+      return (uint16_t) snapshot_ptr->localization_state;
+    case Modbus_input_pulse_count_high:
+      return (uint16_t) ((uint32_t) snapshot_ptr->pulse_count >> 16);
+    case Modbus_input_pulse_count_low:
+      return (uint16_t) snapshot_ptr->pulse_count;
+    case Modbus_input_end_pos_mm:
+      return snapshot_ptr->end_pos_mm;
+    case Modbus_input_center_pos_mm:
+      return (uint16_t) snapshot_ptr->center_pos_mm;
+    case Modbus_input_start_pos_abs_mm:
+      return snapshot_ptr->start_pos_abs_mm;
+    case Modbus_input_brake_path_mm:
+      return snapshot_ptr->brake_path_mm;
+    case Modbus_input_sequence_high:
+      return (uint16_t) (snapshot_ptr->sequence >> 16);
+    case Modbus_input_sequence_low:
+      return (uint16_t) snapshot_ptr->sequence;
+    default:
+      return 0U;
+  }
+}
+
+static uint16_t Modbus_get_holding_register(const Telemetry_snapshot_t *snapshot_ptr, uint16_t address) {
+  switch ((Modbus_holding_register_t) address) {
+    case Modbus_holding_error_state:
+      return (uint16_t) snapshot_ptr->error_state;
+    case Modbus_holding_operating_mode:
+      return (uint16_t) snapshot_ptr->operating_mode;
+    case Modbus_holding_sail_pos:
+      return (uint16_t) (int16_t) snapshot_ptr->roll_pitch_percentage;
+    case Modbus_holding_max_rpm:
+      return snapshot_ptr->max_rpm;
+    case Modbus_holding_max_distance_error:
+      return snapshot_ptr->max_distance_error;
+    default:
+      return 0U;
+  }
+}
+
+static uint8_t Modbus_set_holding_register(uint16_t address, uint16_t value, boolean_t apply) {
+  int16_t sail_pos = (int16_t) value;
+  int8_t result = COMMAND_OK;
+
+  /* same value ranges as the REST validators */
+  switch ((Modbus_holding_register_t) address) {
+    case Modbus_holding_error_state:
+      if (value != LG_error_state_0_normal && value != LG_error_state_2_wind_speed_fault) {
+        return MODBUS_ILLEGAL_DATA_VALUE;
+      }
+      if (apply == True) {
+        result = Command_add(Command_set_error, (int16_t) value);
+      }
+      break;
+    case Modbus_holding_operating_mode:
+      if (value != LG_operating_mode_manual && value != LG_operating_mode_automatic) {
+        return MODBUS_ILLEGAL_DATA_VALUE;
+      }
+      if (apply == True) {
+        result = Command_add(Command_set_operating_mode, (int16_t) value);
+      }
+      break;
+    case Modbus_holding_sail_pos:
+      if (sail_pos < -MODBUS_MAX_SAIL_POS || sail_pos > MODBUS_MAX_SAIL_POS) {
+        return MODBUS_ILLEGAL_DATA_VALUE;
+      }
+      if (apply == True) {
+        result = Command_add(Command_set_sail_pos, sail_pos);
+      }
+      break;
+    case Modbus_holding_max_rpm:
+      if (value < MODBUS_MIN_RPM || value > MODBUS_MAX_RPM) {
+        return MODBUS_ILLEGAL_DATA_VALUE;
+      }
+      if (apply == True) {
+        result = Command_add(Command_set_max_rpm, (int16_t) value);
+      }
+      break;
+    case Modbus_holding_max_distance_error:
+      if (value < MODBUS_MIN_DISTANCE_ERROR || value > MODBUS_MAX_DISTANCE_ERROR) {
+        return MODBUS_ILLEGAL_DATA_VALUE;
+      }
+      if (apply == True) {
+        result = Command_add(Command_set_max_distance_error, (int16_t) value);
+      }
+      break;
+    default:
+      return MODBUS_ILLEGAL_DATA_ADDRESS;
+  }
+  if (result == COMMAND_DENIED) {
+    return MODBUS_SERVER_DEVICE_FAILURE;
+  }
+  return (result == COMMAND_QUEUE_FULL) ? MODBUS_SERVER_DEVICE_BUSY : 0U;
+}
+
+static size_t Modbus_set_exception(uint8_t *response, uint8_t exception) {
+  response[MODBUS_FUNCTION] |= MODBUS_EXCEPTION_FLAG;
+  response[MODBUS_ADDRESS] = exception;
+  return 0U;
+}
+
+static uint16_t Modbus_saturate(uint32_t value) {
+  return (value > UINT16_MAX) ? UINT16_MAX : (uint16_t) value;
+}
+
+static uint16_t Modbus_get_u16(const uint8_t *buffer) {
+  return (uint16_t) (((uint16_t) buffer[0] << 8) | buffer[1]);
+}
+
+static void Modbus_put_u16(uint8_t *buffer, uint16_t value) {
+  buffer[0] = (uint8_t) (value >> 8);
+  buffer[1] = (uint8_t) value;
+}
@@ -0,0 +1,114 @@
+/**
+ * \file Modbus.h
+ * @date 17 Oct 2026
+ * @brief Modbus TCP application protocol with the register map of the linear guide
+ *
+ * Frame layout (MBAP header and PDU), multi byte values are big endian:
+ *   [0]  transaction id, echoed by the response
+ *   [2]  protocol id, always 0
+ *   [4]  number of the following bytes (unit id and PDU)
+ *   [6]  unit id, echoed by the response
+ *   [7]  function code, the exception response sets MODBUS_EXCEPTION_FLAG
+ *   [8]  data of the function
+ * Values are scaled integers, signed values are sent as two's complement.
+ */
+
+#ifndef MODBUS_MODBUS_H_
+#define MODBUS_MODBUS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* defines -----------------------------------------------------------*/
+#define MODBUS_MBAP_SIZE                  7U
+#define MODBUS_MAX_PDU_SIZE               253U
+#define MODBUS_MAX_ADU_SIZE               (MODBUS_MBAP_SIZE + MODBUS_MAX_PDU_SIZE)
+#define MODBUS_PROTOCOL_ID                0U
+#define MODBUS_EXCEPTION_FLAG             0x80U
+
+/* function codes */
+#define MODBUS_READ_HOLDING_REGISTERS     0x03U
+#define MODBUS_READ_INPUT_REGISTERS       0x04U
+#define MODBUS_WRITE_SINGLE_REGISTER      0x06U
+#define MODBUS_WRITE_MULTIPLE_REGISTERS   0x10U
+
+/* exception codes */
+#define MODBUS_ILLEGAL_FUNCTION           0x01U
+#define MODBUS_ILLEGAL_DATA_ADDRESS       0x02U
+#define MODBUS_ILLEGAL_DATA_VALUE         0x03U
+#define MODBUS_SERVER_DEVICE_FAILURE      0x04U  /* the linear guide refused the mode switch */
+#define MODBUS_SERVER_DEVICE_BUSY         0x06U  /* the command queue of the control task is full */
+
+/* result of Modbus_check_frame */
+#define MODBUS_FRAME_COMPLETE             0
+#define MODBUS_FRAME_INCOMPLETE           1
+#define MODBUS_FRAME_INVALID              2
+
+/* typedefs -----------------------------------------------------------*/
+
+/* input registers (function 0x04) */
+typedef enum {
+  Modbus_input_error_state,            /* LG_error_state_t */
+  Modbus_input_operating_mode,         /* LG_operating_mode_t */
+  Modbus_input_sail_adjustment_mode,   /* int16_t -1: roll, 1: pitch */
+  Modbus_input_is_localized,
+  Modbus_input_sail_pos,               /* int16_t roll / pitch percentage */
+  Modbus_input_current_pos_mm,         /* int16_t */
+  Modbus_input_measured_pos_mm,        /* int16_t position of the distance sensor */
+  Modbus_input_desired_pos_mm,         /* int16_t */
+  Modbus_input_rpm_set_point,
+  Modbus_input_movement,               /* Loc_movement_t */
+  Modbus_input_endswitches,            /* bit 0: front, bit 1: back detected */
+  Modbus_input_current_mA,
+  Modbus_input_wind_speed_x100,        /* saturated at 65535 */
+  Modbus_input_wind_direction_x10,
+  Modbus_input_short_mean_speed_x100,  /* statistics of Wind_History_window_short, saturated */
+  Modbus_input_short_max_speed_x100,
+  Modbus_input_long_mean_speed_x100,   /* statistics of Wind_History_window_long, saturated */
+  Modbus_input_long_max_speed_x100,
+  Modbus_input_gust_active,
+  Modbus_input_gust_count,             /* saturated at 65535 */
+  Modbus_input_localization_state,     /* Loc_state_t */
+  Modbus_input_pulse_count_high,       /* int32_t pulse count of the localization */
+  Modbus_input_pulse_count_low,
+  Modbus_input_end_pos_mm,
+  Modbus_input_center_pos_mm,          /* int16_t */
+  Modbus_input_start_pos_abs_mm,
+  Modbus_input_brake_path_mm,
+  Modbus_input_sequence_high,          /* sequence of the telemetry snapshot, changes every cycle */
+  Modbus_input_sequence_low,
+  Modbus_num_of_input_registers
+} Modbus_input_register_t;
+
+/* holding registers (functions 0x03, 0x06 and 0x10), same value ranges as the REST API */
+typedef enum {
+  Modbus_holding_error_state,          /* write 0: normal, 2: wind speed fault */
+  Modbus_holding_operating_mode,       /* LG_operating_mode_t */
+  Modbus_holding_sail_pos,             /* int16_t -100 ... 100, reads the current percentage */
+  Modbus_holding_max_rpm,              /* 400 ... 2000, stored in FRAM */
+  Modbus_holding_max_distance_error,   /* 5 ... 50 mm, stored in FRAM */
+  Modbus_num_of_holding_registers
+} Modbus_holding_register_t;
+
+/* API function prototypes -----------------------------------------------*/
+
+/**
+ * @brief check the MBAP header of the first frame of a buffer
+ * @param buffer: received bytes
+ * @param length: number of received bytes
+ * @param frame_length_ptr: length of the complete frame
+ * @retval MODBUS_FRAME_COMPLETE, _INCOMPLETE (wait for more bytes)
+ *         or _INVALID (wrong protocol id or length, the stream cannot be framed anymore)
+ */
+int8_t Modbus_check_frame(const uint8_t *buffer, size_t length, size_t *frame_length_ptr);
+
+/**
+ * @brief execute a request and build its response
+ * @param request: complete frame checked by Modbus_check_frame
+ * @param length: length of the frame
+ * @param response: destination of MODBUS_MAX_ADU_SIZE bytes
+ * @retval length of the response
+ */
+size_t Modbus_handle(const uint8_t *request, size_t length, uint8_t *response);
+
+#endif /* MODBUS_MODBUS_H_ */
@@ -0,0 +1,37 @@
+/**
+ * \file Arena.c
+ * @date 17 Oct 2026
+ * @brief Bump allocator on a fixed memory block
+ */
+#include "Arena.h"
+
+/* API function definitions -----------------------------------------------*/
+
+void Arena_init(Arena_t *arena_ptr, void *memory, size_t size) {
+  arena_ptr->memory = (uint8_t*) memory;
+  arena_ptr->size = size;
+  arena_ptr->high_water_mark = 0U;
+  Arena_reset(arena_ptr);
+}
+
+void *Arena_alloc(Arena_t *arena_ptr, size_t size) {
+  void *allocation = NULL;
+  /* round up, so the next allocation stays aligned */
+  size_t aligned_size = (size + ARENA_ALIGNMENT - 1U) & ~(size_t) (ARENA_ALIGNMENT - 1U);
+
+  if (aligned_size < size || aligned_size > arena_ptr->size - arena_ptr->used) {
+    arena_ptr->is_exhausted = True;
+    return NULL;
+  }
+  allocation = &arena_ptr->memory[arena_ptr->used];
+  arena_ptr->used += aligned_size;
+  if (arena_ptr->used > arena_ptr->high_water_mark) {
+    arena_ptr->high_water_mark = arena_ptr->used;
+  }
+  return allocation;
+}
+
+void Arena_reset(Arena_t *arena_ptr) {
+  arena_ptr->used = 0U;
+  arena_ptr->is_exhausted = False;
+}
@@ -0,0 +1,70 @@
+/**
+ * \file Arena.h
+ * @date 17 Oct 2026
+ * @brief Bump allocator on a fixed memory block
+ *
+ * Allocations take the next aligned bytes of the block, single allocations are never freed.
+ * The whole arena is released at once with Arena_reset, so allocation is O(1) and cannot fragment.
+ * The highest fill level since init is kept as high-water mark to size the block.
+ */
+
+#ifndef REST_ARENA_H_
+#define REST_ARENA_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "boolean.h"
+
+/* defines -----------------------------------------------------------*/
+#define ARENA_ALIGNMENT  8U  /* alignment of every allocation, enough for double and uint64_t */
+
+/* typedefs -----------------------------------------------------------*/
+
+/** @struct Arena_t
+ *  @brief state of one arena
+ *  @var Arena_t::memory
+ *  backing store, aligned to ARENA_ALIGNMENT
+ *  @var Arena_t::size
+ *  size of the backing store
+ *  @var Arena_t::used
+ *  number of bytes allocated since the last reset
+ *  @var Arena_t::high_water_mark
+ *  maximum of used since init
+ *  @var Arena_t::is_exhausted
+ *  set if an allocation failed since the last reset
+ */
+typedef struct {
+  uint8_t *memory;
+  size_t size;
+  size_t used;
+  size_t high_water_mark;
+  boolean_t is_exhausted;
+} Arena_t;
+
+/* API function prototypes -----------------------------------------------*/
+
+/**
+ * @brief assign the backing store and clear the arena
+ * @param arena_ptr: ptr to the arena instance
+ * @param memory: backing store, aligned to ARENA_ALIGNMENT
+ * @param size: size of the backing store
+ * @retval none
+ */
+void Arena_init(Arena_t *arena_ptr, void *memory, size_t size);
+
+/**
+ * @brief allocate memory from the arena
+ * @param arena_ptr: ptr to the arena instance
+ * @param size: number of bytes
+ * @retval ptr to the memory, NULL if the arena is exhausted
+ */
+void *Arena_alloc(Arena_t *arena_ptr, size_t size);
+
+/**
+ * @brief release all allocations at once, the high-water mark is kept
+ * @param arena_ptr: ptr to the arena instance
+ * @retval none
+ */
+void Arena_reset(Arena_t *arena_ptr);
+
+#endif /* REST_ARENA_H_ */
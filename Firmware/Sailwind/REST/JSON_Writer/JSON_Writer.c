@@ -0,0 +1,239 @@
+/**
+ * \file JSON_Writer.c
+ * @date 17 Oct 2026
+ * @brief Allocation free JSON writer
+ */
+#include "JSON_Writer.h"
+
+/* defines -----------------------------------------------------------*/
+#define JSON_WRITER_MAX_DECIMALS  9U
+#define JSON_WRITER_UINT_DIGITS   10U  /* digits of UINT32_MAX */
+
+/* private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief append one character
+ * @param writer_ptr: ptr to the writer instance
+ * @param character: character to append
+ * @retval none
+ */
+static void JSON_Writer_put(JSON_Writer_t *writer_ptr, char character);
+
+/**
+ * @brief append a string as it is
+ * @param writer_ptr: ptr to the writer instance
+ * @param text: null terminated string
+ * @retval none
+ */
+static void JSON_Writer_put_raw(JSON_Writer_t *writer_ptr, const char *text);
+
+/**
+ * @brief append a quoted and escaped string
+ * @param writer_ptr: ptr to the writer instance
+ * @param text: null terminated string
+ * @retval none
+ */
+static void JSON_Writer_put_quoted(JSON_Writer_t *writer_ptr, const char *text);
+
+/**
+ * @brief append the decimal digits of a number
+ * @param writer_ptr: ptr to the writer instance
+ * @param value: number to append
+ * @param min_digits: number of digits that are at least written (leading zeros)
+ * @retval none
+ */
+static void JSON_Writer_put_uint(JSON_Writer_t *writer_ptr, uint32_t value, uint8_t min_digits);
+
+/**
+ * @brief append the separator to the previous member and the key
+ * @param writer_ptr: ptr to the writer instance
+ * @param key: member name, NULL for an array element or the root
+ * @retval none
+ */
+static void JSON_Writer_begin_member(JSON_Writer_t *writer_ptr, const char *key);
+
+/**
+ * @brief open an object or array
+ * @param writer_ptr: ptr to the writer instance
+ * @param key: member name, NULL for an array element or the root
+ * @param bracket: '{' or '['
+ * @retval none
+ */
+static void JSON_Writer_open(JSON_Writer_t *writer_ptr, const char *key, char bracket);
+
+/**
+ * @brief close the innermost object or array
+ * @param writer_ptr: ptr to the writer instance
+ * @param bracket: '}' or ']'
+ * @retval none
+ */
+static void JSON_Writer_close(JSON_Writer_t *writer_ptr, char bracket);
+
+/* API function definitions -----------------------------------------------*/
+
+void JSON_Writer_init(JSON_Writer_t *writer_ptr, char *buffer, size_t size) {
+  writer_ptr->buffer = buffer;
+  writer_ptr->size = size;
+  writer_ptr->length = 0U;
+  writer_ptr->depth = 0U;
+  writer_ptr->has_members = 0U;
+  writer_ptr->is_overflow = size == 0U;
+  if (size > 0U) {
+    buffer[0] = '\0';
+  }
+}
+
+void JSON_Writer_begin_object(JSON_Writer_t *writer_ptr, const char *key) {
+  JSON_Writer_open(writer_ptr, key, '{');
+}
+
+void JSON_Writer_end_object(JSON_Writer_t *writer_ptr) {
+  JSON_Writer_close(writer_ptr, '}');
+}
+
+void JSON_Writer_begin_array(JSON_Writer_t *writer_ptr, const char *key) {
+  JSON_Writer_open(writer_ptr, key, '[');
+}
+
+void JSON_Writer_end_array(JSON_Writer_t *writer_ptr) {
+  JSON_Writer_close(writer_ptr, ']');
+}
+
+void JSON_Writer_add_int(JSON_Writer_t *writer_ptr, const char *key, int32_t value) {
+  JSON_Writer_begin_member(writer_ptr, key);
+  if (value < 0) {
+    JSON_Writer_put(writer_ptr, '-');
+  }
+  /* negate in unsigned arithmetic, so INT32_MIN does not overflow */
+  JSON_Writer_put_uint(writer_ptr, value < 0 ? 0U - (uint32_t) value : (uint32_t) value, 1U);
+}
+
+void JSON_Writer_add_uint(JSON_Writer_t *writer_ptr, const char *key, uint32_t value) {
+  JSON_Writer_begin_member(writer_ptr, key);
+  JSON_Writer_put_uint(writer_ptr, value, 1U);
+}
+
+void JSON_Writer_add_fixed(JSON_Writer_t *writer_ptr, const char *key, int32_t value, uint8_t decimals) {
+  uint32_t magnitude = value < 0 ? 0U - (uint32_t) value : (uint32_t) value;
+  uint32_t scale = 1U;
+
+  if (decimals > JSON_WRITER_MAX_DECIMALS) {
+    decimals = JSON_WRITER_MAX_DECIMALS;
+  }
+  for (uint8_t i = 0U; i < decimals; i++) {
+    scale *= 10U;
+  }
+  JSON_Writer_begin_member(writer_ptr, key);
+  if (value < 0) {
+    JSON_Writer_put(writer_ptr, '-');
+  }
+  JSON_Writer_put_uint(writer_ptr, magnitude / scale, 1U);
+  if (decimals > 0U) {
+    JSON_Writer_put(writer_ptr, '.');
+    JSON_Writer_put_uint(writer_ptr, magnitude % scale, decimals);
+  }
+}
+
+void JSON_Writer_add_string(JSON_Writer_t *writer_ptr, const char *key, const char *value) {
+  JSON_Writer_begin_member(writer_ptr, key);
+  JSON_Writer_put_quoted(writer_ptr, value);
+}
+
+size_t JSON_Writer_finish(JSON_Writer_t *writer_ptr) {
+  if (writer_ptr->is_overflow || writer_ptr->depth != 0U) {
+    return 0U;
+  }
+  return writer_ptr->length;
+}
+
+/* private function definitions -----------------------------------------------*/
+
+static void JSON_Writer_put(JSON_Writer_t *writer_ptr, char character) {
+  if (writer_ptr->is_overflow) {
+    return;
+  }
+  /* keep one byte for the terminating null */
+  if (writer_ptr->length + 1U >= writer_ptr->size) {
+    writer_ptr->is_overflow = True;
+    return;
+  }
+  writer_ptr->buffer[writer_ptr->length++] = character;
+  writer_ptr->buffer[writer_ptr->length] = '\0';
+}
+
+static void JSON_Writer_put_raw(JSON_Writer_t *writer_ptr, const char *text) {
+  while (*text != '\0') {
+    JSON_Writer_put(writer_ptr, *text++);
+  }
+}
+
+static void JSON_Writer_put_quoted(JSON_Writer_t *writer_ptr, const char *text) {
+  static const char hex_digits[] = "0123456789abcdef";
+
+  JSON_Writer_put(writer_ptr, '"');
+  for (; *text != '\0'; text++) {
+    if (*text == '"' || *text == '\\') {
+      JSON_Writer_put(writer_ptr, '\\');
+      JSON_Writer_put(writer_ptr, *text);
+    } else if ((uint8_t) *text < 0x20U) {
+      JSON_Writer_put_raw(writer_ptr, "\\u00");
+      JSON_Writer_put(writer_ptr, hex_digits[(uint8_t) *text >> 4]);
+      JSON_Writer_put(writer_ptr, hex_digits[(uint8_t) *text & 0x0FU]);
+    } else {
+      JSON_Writer_put(writer_ptr, *text);
+    }
+  }
+  JSON_Writer_put(writer_ptr, '"');
+}
+
+static void JSON_Writer_put_uint(JSON_Writer_t *writer_ptr, uint32_t value, uint8_t min_digits) {
+  char digits[JSON_WRITER_UINT_DIGITS];
+  uint8_t num_of_digits = 0U;
+
+  do {
+    digits[num_of_digits++] = (char) ('0' + value % 10U);
+    value /= 10U;
+  } while (value != 0U);
+  while (num_of_digits < min_digits && num_of_digits < JSON_WRITER_UINT_DIGITS) {
+    digits[num_of_digits++] = '0';
+  }
+  while (num_of_digits > 0U) {
+    JSON_Writer_put(writer_ptr, digits[--num_of_digits]);
+  }
+}
+
+static void JSON_Writer_begin_member(JSON_Writer_t *writer_ptr, const char *key) {
+  uint8_t member_bit = 0U;
+
+  if (writer_ptr->depth > 0U) {
+    member_bit = 1U << (writer_ptr->depth - 1U);
+    if (writer_ptr->has_members & member_bit) {
+      JSON_Writer_put(writer_ptr, ',');
+    }
+    writer_ptr->has_members |= member_bit;
+  }
+  if (key != NULL) {
+    JSON_Writer_put_quoted(writer_ptr, key);
+    JSON_Writer_put(writer_ptr, ':');
+  }
+}
+
+static void JSON_Writer_open(JSON_Writer_t *writer_ptr, const char *key, char bracket) {
+  if (writer_ptr->depth >= JSON_WRITER_MAX_DEPTH) {
+    writer_ptr->is_overflow = True;
+    return;
+  }
+  JSON_Writer_begin_member(writer_ptr, key);
+  JSON_Writer_put(writer_ptr, bracket);
+  writer_ptr->depth++;
+  writer_ptr->has_members &= (uint8_t) ~(1U << (writer_ptr->depth - 1U));
+}
+
+static void JSON_Writer_close(JSON_Writer_t *writer_ptr, char bracket) {
+  if (writer_ptr->depth == 0U) {
+    writer_ptr->is_overflow = True;
+    return;
+  }
+  JSON_Writer_put(writer_ptr, bracket);
+  writer_ptr->depth--;
+}
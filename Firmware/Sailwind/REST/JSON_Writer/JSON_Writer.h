@@ -0,0 +1,133 @@
+/**
+ * \file JSON_Writer.h
+ * @date 17 Oct 2026
+ * @brief Allocation free JSON writer
+ *
+ * Keys and values are appended straight into a caller provided buffer. Every write is bounds checked:
+ * once the buffer is full, the writer stops writing and reports the overflow in JSON_Writer_finish.
+ * Numbers are formatted without printf, fixed-point values are written with a given number of decimals.
+ * The output is compact (no whitespace).
+ */
+
+#ifndef REST_JSON_WRITER_H_
+#define REST_JSON_WRITER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "boolean.h"
+
+/* defines -----------------------------------------------------------*/
+#define JSON_WRITER_MAX_DEPTH  8U  /* maximum nesting of objects and arrays */
+
+/* typedefs -----------------------------------------------------------*/
+
+/** @struct JSON_Writer_t
+ *  @brief state of one JSON document
+ *  @var JSON_Writer_t::buffer
+ *  destination of the JSON text, always null terminated
+ *  @var JSON_Writer_t::size
+ *  size of the buffer including the terminating null
+ *  @var JSON_Writer_t::length
+ *  number of characters written
+ *  @var JSON_Writer_t::depth
+ *  number of open objects and arrays
+ *  @var JSON_Writer_t::has_members
+ *  bit (depth - 1) is set if the innermost object or array already has a member
+ *  @var JSON_Writer_t::is_overflow
+ *  set if the buffer was too small or the nesting too deep
+ */
+typedef struct {
+  char *buffer;
+  size_t size;
+  size_t length;
+  uint8_t depth;
+  uint8_t has_members;
+  boolean_t is_overflow;
+} JSON_Writer_t;
+
+/* API function prototypes -----------------------------------------------*/
+
+/**
+ * @brief start a document in a buffer
+ * @param writer_ptr: ptr to the writer instance
+ * @param buffer: destination of the JSON text
+ * @param size: size of the buffer
+ * @retval none
+ */
+void JSON_Writer_init(JSON_Writer_t *writer_ptr, char *buffer, size_t size);
+
+/**
+ * @brief open an object
+ * @param writer_ptr: ptr to the writer instance
+ * @param key: member name inside an object, NULL for the root or an array element
+ * @retval none
+ */
+void JSON_Writer_begin_object(JSON_Writer_t *writer_ptr, const char *key);
+
+/**
+ * @brief close the innermost object
+ * @param writer_ptr: ptr to the writer instance
+ * @retval none
+ */
+void JSON_Writer_end_object(JSON_Writer_t *writer_ptr);
+
+/**
+ * @brief open an array
+ * @param writer_ptr: ptr to the writer instance
+ * @param key: member name inside an object, NULL for the root or an array element
+ * @retval none
+ */
+void JSON_Writer_begin_array(JSON_Writer_t *writer_ptr, const char *key);
+
+/**
+ * @brief close the innermost array
+ * @param writer_ptr: ptr to the writer instance
+ * @retval none
+ */
+void JSON_Writer_end_array(JSON_Writer_t *writer_ptr);
+
+/**
+ * @brief write a signed integer
+ * @param writer_ptr: ptr to the writer instance
+ * @param key: member name inside an object, NULL for an array element
+ * @param value: value to write
+ * @retval none
+ */
+void JSON_Writer_add_int(JSON_Writer_t *writer_ptr, const char *key, int32_t value);
+
+/**
+ * @brief write an unsigned integer
+ * @param writer_ptr: ptr to the writer instance
+ * @param key: member name inside an object, NULL for an array element
+ * @param value: value to write
+ * @retval none
+ */
+void JSON_Writer_add_uint(JSON_Writer_t *writer_ptr, const char *key, uint32_t value);
+
+/**
+ * @brief write a fixed-point number, e.g. value 1250 with 2 decimals is written as 12.50
+ * @param writer_ptr: ptr to the writer instance
+ * @param key: member name inside an object, NULL for an array element
+ * @param value: value scaled by 10^decimals
+ * @param decimals: number of decimals (at most 9)
+ * @retval none
+ */
+void JSON_Writer_add_fixed(JSON_Writer_t *writer_ptr, const char *key, int32_t value, uint8_t decimals);
+
+/**
+ * @brief write a string, quotes, backslashes and control characters are escaped
+ * @param writer_ptr: ptr to the writer instance
+ * @param key: member name inside an object, NULL for an array element
+ * @param value: null terminated string
+ * @retval none
+ */
+void JSON_Writer_add_string(JSON_Writer_t *writer_ptr, const char *key, const char *value);
+
+/**
+ * @brief check the document after the root was closed
+ * @param writer_ptr: ptr to the writer instance
+ * @retval length of the JSON text, 0 if it did not fit into the buffer
+ */
+size_t JSON_Writer_finish(JSON_Writer_t *writer_ptr);
+
+#endif /* REST_JSON_WRITER_H_ */
@@ -6,39 +6,83 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
 #include "string.h"
+#include "REST.h"
 #include "cJSON.h"
+#include "JSON_Writer.h"
+#include "Arena.h"
 #include "Linear_Guide.h"
-#include "FRAM.h"
-#include "FRAM_memory_mapping.h"
+#include "Command.h"
 #include "WSWD.h"
-#include "IO.h"
+#include "Telemetry.h"
+#include "WebSocket.h"
+#include "udp_publisher.h"
 
 #define GET_REQUEST           "GET"
 #define PUT_REQUEST           "PUT"
 
-#define PATH_DATA             "/data "
-#define PATH_STATUS           "/data/status "
-#define PATH_SAIL_STATE       "/data/adjustment "
-#define PATH_SENSORS          "/data/sensors "
-#define PATH_CURRENT_SENSOR   "/data/sensors/current "
-#define PATH_WIND_SENSOR      "/data/sensors/wind "
-#define PATH_SETTINGS         "/data/settings "
-
-#define PATH_ERROR            "/data/status/error "
-#define PATH_MODE             "/data/status/operating_mode "
+#define PATH_DATA             "/data"
+#define PATH_STATUS           "/data/status"
+#define PATH_SAIL_STATE       "/data/adjustment"
+#define PATH_SENSORS          "/data/sensors"
+#define PATH_CURRENT_SENSOR   "/data/sensors/current"
+#define PATH_WIND_SENSOR      "/data/sensors/wind"
+#define PATH_SETTINGS         "/data/settings"
+#define PATH_UDP_SETTINGS     "/data/settings/udp"
+#define PATH_STREAM           "/data/stream"
+#define PATH_BATCH            "/data/batch"
+#define PATH_WEBSOCKET        "/data/ws"
+
+#define PATH_ERROR            "/data/status/error"
+#define PATH_MODE             "/data/status/operating_mode"
+
+#define REST_METHOD_GET       0x01U
+#define REST_METHOD_PUT       0x02U
+#define REST_STREAM           0x04U  /* GET answers with an event stream of the /data json */
+#define REST_WEBSOCKET        0x08U  /* GET upgrades the connection to a WebSocket */
+
+#define BATCH_FIELDS_PARAM    "?fields="
+#define BATCH_FIELD_SEPARATOR ','
+
+#define STREAM_INTERVAL_PARAM "?interval_ms="
+#define STREAM_MIN_INTERVAL   100U     /* ms */
+#define STREAM_MAX_INTERVAL   60000U   /* ms */
+#define STREAM_HEADER         "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\n\r\n"
+#define STREAM_EVENT_DATA     "data: "
+#define STREAM_END_OF_EVENT   "\n\n"
+
+#define WEBSOCKET_KEY         "Sec-WebSocket-Key:"
+#define WEBSOCKET_HEADER      "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n" \
+                              "Sec-WebSocket-Accept: "
+#define WEBSOCKET_RESULT_OK       "{\"result\":\"ok\"}"
+#define WEBSOCKET_RESULT_INVALID  "{\"result\":\"invalid\"}"
+#define WEBSOCKET_RESULT_BUSY     "{\"result\":\"busy\"}"
+#define WEBSOCKET_RESULT_DENIED   "{\"result\":\"denied\"}"
 
 #define HTTP_SUCCESS          "200 OK\r\n"
+#define HTTP_NOT_MODIFIED     "304 Not Modified\r\n"
 #define HTTP_NOT_FOUND        "404 Not Found\r\n"
 #define HTTP_NOT_IMPLEMENTED  "501 Not Implemented\r\n"
 #define HTTP_BAD_REQ          "400 Bad Request\r\n"
+#define HTTP_NOT_ALLOWED      "405 Method Not Allowed\r\n"
+#define HTTP_TOO_LARGE        "413 Payload Too Large\r\n"
+#define HTTP_INTERNAL_ERROR   "500 Internal Server Error\r\n"
+#define HTTP_CONFLICT         "409 Conflict\r\n"
+#define HTTP_UNAVAILABLE      "503 Service Unavailable\r\n"
 #define HOST_NAME             "Host: 192.168.0.123\r\n"
 #define CONTENT_TYPE          "Content-Type: application/json\r\n"
 #define END_OF_HEADER         "\r\n\r\n"
 #define CONTENT_LEN           "Content-Length: "
+#define ETAG                  "ETag: "
+#define IF_NONE_MATCH         "If-None-Match:"
+#define ETAG_ANY              "*"
+#define ETAG_LENGTH           10U   /* quoted 8 hex digits */
+#define FNV_OFFSET_BASIS      2166136261UL
+#define FNV_PRIME             16777619UL
 
 #define HTTP_VER              "HTTP/1.1 "
-#define URL_OFFSET            4U
 
 #define KEY_ERROR             "error"
 #define KEY_MODE              "operating_mode"
@@ -51,32 +95,200 @@
 #define KEY_LOCALIZED         "localized"
 #define KEY_MAX_RPM           "max_rpm"
 #define KEY_MAX_DISTANCE      "max_distance_error"
+#define KEY_UDP_INTERVAL      "interval_ms"
+#define KEY_UNIT              "unit"
+#define KEY_WINDOWS           "windows"
+#define KEY_DURATION          "duration_ms"
+#define KEY_SAMPLES           "samples"
+#define KEY_MEAN              "mean"
+#define KEY_MAX               "max"
+#define KEY_VARIANCE          "variance"
+#define KEY_STEADINESS        "steadiness"
+#define KEY_GUST              "gust"
+#define KEY_ACTIVE            "active"
+#define KEY_COUNT             "count"
+#define KEY_PEAK              "peak"
+#define KEY_AGE               "age_ms"
+#define KEY_POSITION          "position_mm"
+#define KEY_MOVEMENT          "movement"
+#define KEY_ENDSWITCHES       "endswitches"
+#define KEY_FRONT             "front"
+#define KEY_BACK              "back"
+
+#define REST_HEADER_SIZE      128U  /* space reserved in front of the body for the longest header */
+#define REST_ARENA_SIZE       1024U /* cJSON items and strings of one PUT request */
+
+/* results of a put handler besides 0 (valid) and 1 (invalid) */
+#define REST_CHECK_BUSY       2U    /* valid, but the command queue is full */
+#define REST_CHECK_DENIED     3U    /* valid, but refused by the linear guide */
 
 typedef enum {
   HTTP_OK,
+  HTTP_Not_Modified,
   HTTP_Not_Implemented,
   HTTP_Not_Found,
-  HTTP_Bad_Request
+  HTTP_Bad_Request,
+  HTTP_Method_Not_Allowed,
+  HTTP_Payload_Too_Large,
+  HTTP_Internal_Error,
+  HTTP_Conflict,
+  HTTP_Service_Unavailable
 } http_responses_t;
 
-static Linear_Guide_t* REST_linear_guide = {0};
-static IO_analogSensor_t *REST_current_sensor = {0};
+typedef void (*REST_get_handler_t)(JSON_Writer_t *writer);
+typedef uint8_t (*REST_put_handler_t)(cJSON *request, boolean_t apply);
+
+/** @struct REST_route_t
+ *  @brief  entry of the route table
+ *  @var REST_route_t::path
+ *  path without query string
+ *  @var REST_route_t::path_length
+ *  strlen of path
+ *  @var REST_route_t::methods
+ *  mask of the allowed methods (REST_METHOD_x) and REST_STREAM
+ *  @var REST_route_t::get_handler
+ *  writes the members of the response JSON of a GET request
+ *  @var REST_route_t::put_handler
+ *  checks the request JSON of a PUT request and applies it if apply is True, returns 1 if it is invalid,
+ *  REST_CHECK_BUSY or REST_CHECK_DENIED if it could not be applied
+ */
+typedef struct {
+  const char *path;
+  size_t path_length;
+  uint8_t methods;
+  REST_get_handler_t get_handler;
+  REST_put_handler_t put_handler;
+} REST_route_t;
+
+#define REST_ROUTE(path, methods, get_handler, put_handler) \
+  { path, sizeof(path) - 1U, methods, get_handler, put_handler }
+
+/** @struct REST_batch_field_t
+ *  @brief  entry of the field table of the batch route
+ *  @var REST_batch_field_t::key
+ *  key of the member, also the name of the field in the query string
+ *  @var REST_batch_field_t::get_handler
+ *  writes the member
+ *  @var REST_batch_field_t::put_handler
+ *  checks and applies the member of a batch PUT, NULL if it is read only
+ */
+typedef struct {
+  const char *key;
+  REST_get_handler_t get_handler;
+  REST_put_handler_t put_handler;
+} REST_batch_field_t;
+
+static Telemetry_snapshot_t REST_snapshot;
+static const char *REST_query = "";
+static uint64_t REST_arena_memory[REST_ARENA_SIZE / sizeof(uint64_t)];
+static Arena_t REST_arena;
+
+/**
+ * @brief  cJSON malloc hook, allocates from the request arena
+ * @param  size: number of bytes
+ * @retval pointer to the memory or NULL if the arena is exhausted
+ */
+static void* REST_arena_malloc(size_t size);
+
+/**
+ * @brief  cJSON free hook, memory is released by resetting the arena after the request
+ * @param  pointer: pointer to the memory
+ * @retval none
+ */
+static void REST_arena_free(void *pointer);
 
 /**
- * @brief  Handles HTTP GET requests
+ * @brief  Parse the method of the request line
+ * @param  payload: pointer to received payload
+ * @param  path: set to the first character of the path
+ * @retval REST_METHOD_x or 0 if the method is not implemented
+ */
+static uint8_t REST_parse_method(char *payload, char **path);
+
+/**
+ * @brief  Find the route of a path
+ * @param  path: pointer to the path in the request line
+ * @param  path_length: length of the path without query string
+ * @retval pointer to the route or NULL
+ */
+static const REST_route_t* REST_find_route(const char *path, size_t path_length);
+
+/**
+ * @brief  Handles HTTP GET requests, answers 304 if the client already has the body
+ * @param  route: pointer to the route of the path
  * @param  payload: pointer to received payload
  * @param  buffer: pointer to http response buffer
  * @retval none
  */
-static void REST_get_request(char *payload, char *buffer);
+static void REST_get_request(const REST_route_t *route, const char *payload, char *buffer);
+
+/**
+ * @brief  Calculates the entity tag of a body (32 bit FNV-1a), it changes with any serialized field
+ * @param  body: pointer to the body
+ * @param  length: length of the body
+ * @retval hash of the body
+ */
+static uint32_t REST_calculate_etag(const char *body, size_t length);
+
+/**
+ * @brief  Checks if the If-None-Match header field of the request lists the entity tag
+ * @param  payload: pointer to received payload
+ * @param  etag: quoted entity tag of the current body
+ * @retval 1 if the body of the client is up to date, 0 otherwise
+ */
+static uint8_t REST_check_if_none_match(const char *payload, const char *etag);
+
+/**
+ * @brief  Compares the name of a header field case-insensitive
+ * @param  line: pointer to the header line
+ * @param  field: name of the field including the colon
+ * @retval 1 if the line starts with the field, 0 otherwise
+ */
+static uint8_t REST_header_field_matches(const char *line, const char *field);
+
+/**
+ * @brief  Adds the ETag field to a complete HTTP header
+ * @param  buffer: pointer to http response buffer holding the header
+ * @param  etag: quoted entity tag
+ * @retval none
+ */
+static void REST_add_etag(char *buffer, const char *etag);
+
+/**
+ * @brief  Starts an event stream, the interval is taken from the query string
+ * @param  query: pointer to the character behind the path
+ * @param  buffer: pointer to http response buffer
+ * @param  stream_ptr: pointer to the stream parameters
+ * @retval none
+ */
+static void REST_stream_request(const char *query, char *buffer, REST_stream_t *stream_ptr);
+
+/**
+ * @brief  Answers the opening handshake of a WebSocket, the events follow with REST_create_websocket_event
+ * @param  payload: pointer to received payload
+ * @param  buffer: pointer to http response buffer
+ * @param  stream_ptr: pointer to the stream parameters
+ * @retval none
+ */
+static void REST_websocket_request(const char *payload, char *buffer, REST_stream_t *stream_ptr);
+
+/**
+ * @brief  Finds the value of a header field
+ * @param  payload: pointer to received payload
+ * @param  field: name of the field including the colon
+ * @param  length: set to the length of the value without surrounding whitespace
+ * @retval pointer to the value or NULL if the header has no such field
+ */
+static const char* REST_find_header_field(const char *payload, const char *field, size_t *length);
 
 /**
  * @brief  Handles HTTP PUT requests
+ * @param  route: pointer to the route of the path
  * @param  payload: pointer to received payload
  * @param  buffer: pointer to http response buffer
  * @retval none
  */
-static void REST_put_request(char *payload, char *buffer);
+static void REST_put_request(const REST_route_t *route, char *payload, char *buffer);
 
 /**
  * @brief  Build HTTP header with given
@@ -89,235 +301,513 @@ static void REST_create_HTTP_header(char *buffer, http_responses_t response,
 
 /**
  * @brief  Build the /data json
- * @param  response: pointer to HTTP response JSON
+ * @param  writer: pointer to the writer of the HTTP response JSON
  * @retval none
  */
-static void REST_create_data_json(cJSON *response);
+static void REST_create_data_json(JSON_Writer_t *writer);
 
 /**
  * @brief  Build the /data/status json
- * @param  response: pointer to HTTP response JSON
+ * @param  writer: pointer to the writer of the HTTP response JSON
  * @retval none
  */
-static void REST_create_status_json(cJSON *response);
+static void REST_create_status_json(JSON_Writer_t *writer);
 
 /**
  * @brief  Build the /data/sensors json
- * @param  response: pointer to HTTP response JSON
+ * @param  writer: pointer to the writer of the HTTP response JSON
+ * @retval none
+ */
+static void REST_create_sensors_json(JSON_Writer_t *writer);
+
+/**
+ * @brief  Build the /data/sensors/current json
+ * @param  writer: pointer to the writer of the HTTP response JSON
  * @retval none
  */
-static void REST_create_sensors_json(cJSON *response);
+static void REST_create_current_json(JSON_Writer_t *writer);
+
+/**
+ * @brief  Build the wind array of the latest sample
+ * @param  writer: pointer to the writer of the HTTP response JSON
+ * @retval none
+ */
+static void REST_create_wind_json(JSON_Writer_t *writer);
 
 /**
  * @brief  Build the /data/sensors/wind json
- * @param  response: pointer to HTTP response JSON
+ * @param  writer: pointer to the writer of the HTTP response JSON
  * @retval none
  */
-static void REST_create_wind_json(cJSON *response);
+static void REST_create_wind_sensor_json(JSON_Writer_t *writer);
+
+/**
+ * @brief  Build the windowed statistics and gust state of the wind history
+ * @param  writer: pointer to the writer of the HTTP response JSON
+ * @retval none
+ */
+static void REST_create_wind_summary_json(JSON_Writer_t *writer);
 
 /**
  * @brief  Build the /data/adjustment json
- * @param  response: pointer to HTTP response JSON
+ * @param  writer: pointer to the writer of the HTTP response JSON
  * @retval none
  */
-static void REST_create_adjustment(cJSON *response);
+static void REST_create_adjustment(JSON_Writer_t *writer);
+
+static void REST_create_error_json(JSON_Writer_t *writer);
+
+static void REST_create_localized_json(JSON_Writer_t *writer);
+
+static void REST_create_position_json(JSON_Writer_t *writer);
+
+static void REST_create_movement_json(JSON_Writer_t *writer);
+
+static void REST_create_endswitches_json(JSON_Writer_t *writer);
+
+/**
+ * @brief  Build the /data/batch json of the fields listed in the query string, all fields without query
+ * @param  writer: pointer to the writer of the HTTP response JSON
+ * @retval none
+ */
+static void REST_create_batch_json(JSON_Writer_t *writer);
+
+/**
+ * @brief  check if a field is listed in the comma separated field list of the query
+ * @param  fields: pointer to the field list
+ * @param  length: length of the field list
+ * @param  key: name of the field
+ * @retval 1 if it is listed, 0 otherwise
+ */
+static uint8_t REST_is_field_listed(const char *fields, size_t length, const char *key);
+
+/**
+ * @brief  check all members of the received batch json, apply them only if every member is valid
+ * @param  batch_json: pointer to received JSON
+ * @param  apply: apply the members of a valid JSON
+ * @retval 0 valid, 1 invalid, REST_CHECK_BUSY or REST_CHECK_DENIED
+ */
+static uint8_t REST_check_batch_json(cJSON *batch_json, boolean_t apply);
+
+/**
+ * @brief  convert the result of an added command to the result of a put handler
+ * @param  result: COMMAND_x
+ * @retval 0, REST_CHECK_BUSY or REST_CHECK_DENIED
+ */
+static uint8_t REST_get_command_result(int8_t result);
+
 /**
  * @brief  check if the received error json is valid
  * @param  error_json: pointer to received JSON
- * @retval none
+ * @param  apply: set the error state if the JSON is valid
+ * @retval 0 valid, 1 invalid, REST_CHECK_BUSY or REST_CHECK_DENIED
  */
-static uint8_t REST_check_error_json(cJSON *error_json);
+static uint8_t REST_check_error_json(cJSON *error_json, boolean_t apply);
 
 /**
  * @brief  check if the received sailstate json is valid
  * @param  sailstate_json: pointer to received JSON
- * @retval none
+ * @param  apply: set the desired sail position if the JSON is valid
+ * @retval 0 valid, 1 invalid, REST_CHECK_BUSY or REST_CHECK_DENIED
  */
-static uint8_t REST_check_sailstate_json(cJSON *sailstate_json);
+static uint8_t REST_check_sailstate_json(cJSON *sailstate_json, boolean_t apply);
 
 /**
  * @brief  check if the received operating_mode json is valid
  * @param  mode_json: pointer to received JSON
- * @retval none
+ * @param  apply: set the operating mode if the JSON is valid
+ * @retval 0 valid, 1 invalid, REST_CHECK_BUSY or REST_CHECK_DENIED
  */
-static uint8_t REST_check_mode_json(cJSON *mode_json);
+static uint8_t REST_check_mode_json(cJSON *mode_json, boolean_t apply);
+
+static uint8_t REST_check_settings_json(cJSON *settings_json, boolean_t apply);
 
-static uint8_t REST_check_settings_json(cJSON *settings_json);
+static void REST_create_settings_json(JSON_Writer_t *writer);
 
-static void REST_create_settings_json(cJSON *response);
+/**
+ * @brief  check the received /data/settings/udp json and set the publishing rate if it is valid
+ * @param  udp_json: parsed json of the request
+ * @param  apply: set and save the rate if the JSON is valid
+ * @retval 0 if the JSON is valid, else 1
+ */
+static uint8_t REST_check_udp_settings_json(cJSON *udp_json, boolean_t apply);
+
+/**
+ * @brief  Build the /data/settings/udp json
+ * @param  writer: pointer to the writer of the HTTP response JSON
+ * @retval none
+ */
+static void REST_create_udp_settings_json(JSON_Writer_t *writer);
+
+/**
+ * @brief  Build the /data/status/operating_mode json
+ * @param  writer: pointer to the writer of the HTTP response JSON
+ * @retval none
+ */
+static void REST_create_mode_json(JSON_Writer_t *writer);
+
+/* adding an endpoint only needs an entry here */
+static const REST_route_t REST_routes[] = {
+  REST_ROUTE(PATH_DATA, REST_METHOD_GET, REST_create_data_json, NULL),
+  REST_ROUTE(PATH_STATUS, REST_METHOD_GET, REST_create_status_json, NULL),
+  REST_ROUTE(PATH_ERROR, REST_METHOD_PUT, NULL, REST_check_error_json),
+  REST_ROUTE(PATH_MODE, REST_METHOD_GET | REST_METHOD_PUT, REST_create_mode_json, REST_check_mode_json),
+  REST_ROUTE(PATH_SAIL_STATE, REST_METHOD_GET | REST_METHOD_PUT, REST_create_adjustment, REST_check_sailstate_json),
+  REST_ROUTE(PATH_SENSORS, REST_METHOD_GET, REST_create_sensors_json, NULL),
+  REST_ROUTE(PATH_CURRENT_SENSOR, REST_METHOD_GET, REST_create_current_json, NULL),
+  REST_ROUTE(PATH_WIND_SENSOR, REST_METHOD_GET, REST_create_wind_sensor_json, NULL),
+  REST_ROUTE(PATH_SETTINGS, REST_METHOD_GET | REST_METHOD_PUT, REST_create_settings_json, REST_check_settings_json),
+  REST_ROUTE(PATH_UDP_SETTINGS, REST_METHOD_GET | REST_METHOD_PUT, REST_create_udp_settings_json, REST_check_udp_settings_json),
+  REST_ROUTE(PATH_STREAM, REST_METHOD_GET | REST_STREAM, NULL, NULL),
+  REST_ROUTE(PATH_BATCH, REST_METHOD_GET | REST_METHOD_PUT, REST_create_batch_json, REST_check_batch_json),
+  REST_ROUTE(PATH_WEBSOCKET, REST_METHOD_GET | REST_WEBSOCKET, NULL, NULL)
+};
+
+/* values of one controllino cycle, the members with a put_handler are applied in this order */
+static const REST_batch_field_t REST_batch_fields[] = {
+  { KEY_LOCALIZED, REST_create_localized_json, NULL },
+  { KEY_CURRENT, REST_create_current_json, NULL },
+  { KEY_MOVEMENT, REST_create_movement_json, NULL },
+  { KEY_ENDSWITCHES, REST_create_endswitches_json, NULL },
+  { KEY_POSITION, REST_create_position_json, NULL },
+  { KEY_ERROR, REST_create_error_json, REST_check_error_json },
+  { KEY_MODE, REST_create_mode_json, REST_check_mode_json },
+  { KEY_SAIL_POS, REST_create_adjustment, REST_check_sailstate_json },
+  { KEY_WIND, REST_create_wind_json, NULL }
+};
 
 void REST_init(void)
 {
-  REST_linear_guide = LG_get_Linear_Guide();
-  REST_current_sensor = IO_get_current_sensor();
+  Arena_init(&REST_arena, REST_arena_memory, sizeof(REST_arena_memory));
 }
 
-void REST_request_handler(char *payload, char *buffer) {
-
-  char http_request[4];
-  memcpy(http_request, payload, 3U);
-  http_request[3] = '\0';
+size_t REST_get_arena_high_water_mark(void) {
+  return REST_arena.high_water_mark;
+}
 
-  /* check for GET request */
-  if (strcmp(http_request, GET_REQUEST) == 0) {
-    REST_get_request(payload, buffer);
+void REST_request_handler(char *payload, char *buffer, REST_stream_t *stream_ptr) {
+  const REST_route_t *route;
+  char *path = payload;
+  uint8_t method = REST_parse_method(payload, &path);
+  size_t path_length = 0U;
 
-    /* check for PUT request */
-  } else if (strcmp(http_request, PUT_REQUEST) == 0) {
-    REST_put_request(payload, buffer);
+  stream_ptr->is_requested = False;
+  stream_ptr->is_websocket = False;
 
-    /* if not GET or PUT return HTTP status code 501 */
-  } else {
+  /* if not GET or PUT return HTTP status code 501 */
+  if (method == 0U) {
     REST_create_HTTP_header(buffer, HTTP_Not_Implemented, 0);
+    return;
+  }
+  /* the path ends before the HTTP version or the query string */
+  path_length = strcspn(path, " ?\r\n");
+  REST_query = path + path_length;
+  route = REST_find_route(path, path_length);
+  if (route == NULL) {
+    REST_create_HTTP_header(buffer, HTTP_Not_Found, 0);
+  } else if ((route->methods & method) == 0U) {
+    REST_create_HTTP_header(buffer, HTTP_Method_Not_Allowed, 0);
+  } else if (method == REST_METHOD_GET && (route->methods & REST_STREAM) != 0U) {
+    REST_stream_request(path + path_length, buffer, stream_ptr);
+  } else if (method == REST_METHOD_GET && (route->methods & REST_WEBSOCKET) != 0U) {
+    REST_websocket_request(payload, buffer, stream_ptr);
+  } else if (method == REST_METHOD_GET) {
+    REST_get_request(route, payload, buffer);
+  } else {
+    REST_put_request(route, payload, buffer);
   }
 }
 
-static void REST_get_request(char *payload, char *buffer) {
-
-  cJSON *response = cJSON_CreateObject();
-  char JSON_response[200];
-  memset(JSON_response, '\0', 1);
+static uint8_t REST_parse_method(char *payload, char **path) {
+  if (strncmp(payload, GET_REQUEST " ", strlen(GET_REQUEST " ")) == 0) {
+    *path = payload + strlen(GET_REQUEST " ");
+    return REST_METHOD_GET;
+  }
+  if (strncmp(payload, PUT_REQUEST " ", strlen(PUT_REQUEST " ")) == 0) {
+    *path = payload + strlen(PUT_REQUEST " ");
+    return REST_METHOD_PUT;
+  }
+  return 0U;
+}
 
-  /* check for path /data */
-  if (strncmp(payload + URL_OFFSET, PATH_DATA, strlen(PATH_DATA)) == 0) {
+static const REST_route_t* REST_find_route(const char *path, size_t path_length) {
+  for (uint8_t i = 0U; i < sizeof(REST_routes) / sizeof(REST_routes[0]); i++) {
+    if (REST_routes[i].path_length == path_length
+        && memcmp(REST_routes[i].path, path, path_length) == 0) {
+      return &REST_routes[i];
+    }
+  }
+  return NULL;
+}
 
-    REST_create_data_json(response);
-    cJSON_PrintPreallocated(response, JSON_response, 200, 1);
-    REST_create_HTTP_header(buffer, HTTP_OK, strlen(JSON_response));
+static void REST_get_request(const REST_route_t *route, const char *payload, char *buffer) {
+  JSON_Writer_t writer;
+  char *body = buffer + REST_HEADER_SIZE;
+  size_t body_length = 0U;
+  char etag[ETAG_LENGTH + 1U];
+
+  /* the body is written behind the space of the header, whose length depends on the body length */
+  Telemetry_get_snapshot(&REST_snapshot);
+  JSON_Writer_init(&writer, body, REST_RESPONSE_SIZE - REST_HEADER_SIZE);
+  JSON_Writer_begin_object(&writer, NULL);
+  route->get_handler(&writer);
+  JSON_Writer_end_object(&writer);
+  body_length = JSON_Writer_finish(&writer);
+  if (body_length == 0U) {
+    REST_create_HTTP_header(buffer, HTTP_Internal_Error, 0);
+    return;
+  }
+  sprintf(etag, "\"%08lx\"", (unsigned long) REST_calculate_etag(body, body_length));
+  if (REST_check_if_none_match(payload, etag) == 1U) {
+    /* the client's copy is valid, only the header is sent */
+    REST_create_HTTP_header(buffer, HTTP_Not_Modified, body_length);
+    REST_add_etag(buffer, etag);
+    return;
+  }
+  REST_create_HTTP_header(buffer, HTTP_OK, body_length);
+  REST_add_etag(buffer, etag);
+  /* close the gap between header and body, including the terminating null */
+  memmove(buffer + strlen(buffer), body, body_length + 1U);
+}
 
-    /* check for path /data/status */
-  } else if (strncmp(payload + URL_OFFSET, PATH_STATUS, strlen(PATH_STATUS))
-      == 0) {
+static uint32_t REST_calculate_etag(const char *body, size_t length) {
+  uint32_t hash = FNV_OFFSET_BASIS;
 
-    REST_create_status_json(response);
-    cJSON_PrintPreallocated(response, JSON_response, 200, 1);
-    REST_create_HTTP_header(buffer, HTTP_OK, strlen(JSON_response));
+  for (size_t i = 0U; i < length; i++) {
+    hash ^= (uint8_t) body[i];
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
 
-    /* check for path /data/adjustment */
-  } else if (strncmp(payload + URL_OFFSET, PATH_SAIL_STATE,
-                     strlen(PATH_SAIL_STATE)) == 0) {
+static uint8_t REST_check_if_none_match(const char *payload, const char *etag) {
+  const char *end_of_header = strstr(payload, END_OF_HEADER);
+  const char *line = strstr(payload, "\r\n");
+  const char *line_end;
+  const char *value;
 
-    REST_create_adjustment(response);
-    cJSON_PrintPreallocated(response, JSON_response, 200, 1);
-    REST_create_HTTP_header(buffer, HTTP_OK, strlen(JSON_response));
+  if (end_of_header == NULL) {
+    return 0U;
+  }
+  while (line != NULL && line < end_of_header) {
+    line += strlen("\r\n");
+    line_end = strstr(line, "\r\n");
+    if (REST_header_field_matches(line, IF_NONE_MATCH) == 1U) {
+      /* the value is "*" or a comma separated list of quoted entity tags */
+      for (value = line + strlen(IF_NONE_MATCH); value < line_end; value++) {
+        if (strncmp(value, etag, strlen(etag)) == 0 || strncmp(value, ETAG_ANY, strlen(ETAG_ANY)) == 0) {
+          return 1U;
+        }
+      }
+    }
+    line = line_end;
+  }
+  return 0U;
+}
 
-    /* check for path /data/sensors */
-  } else if (strncmp(payload + URL_OFFSET, PATH_SENSORS, strlen(PATH_SENSORS))
-      == 0) {
+static uint8_t REST_header_field_matches(const char *line, const char *field) {
+  for (size_t i = 0U; field[i] != '\0'; i++) {
+    if (tolower((unsigned char) line[i]) != tolower((unsigned char) field[i])) {
+      return 0U;
+    }
+  }
+  return 1U;
+}
 
-    REST_create_sensors_json(response);
-    cJSON_PrintPreallocated(response, JSON_response, 200, 1);
-    REST_create_HTTP_header(buffer, HTTP_OK, strlen(JSON_response));
+static void REST_add_etag(char *buffer, const char *etag) {
+  /* the field is inserted in front of the empty line that ends the header */
+  char *end_of_header = buffer + strlen(buffer) - strlen(END_OF_HEADER);
 
-    /* check for path /data/sensors/current */
-  } else if (strncmp(payload + URL_OFFSET, PATH_CURRENT_SENSOR,
-                     strlen(PATH_CURRENT_SENSOR)) == 0) {
+  sprintf(end_of_header, "\r\n" ETAG "%s" END_OF_HEADER, etag);
+}
 
-    IO_Get_Measured_Value(REST_current_sensor);
-    cJSON_AddNumberToObject(response, KEY_CURRENT, REST_current_sensor->measured_value);
-    cJSON_PrintPreallocated(response, JSON_response, 200, 1);
-    REST_create_HTTP_header(buffer, HTTP_OK, strlen(JSON_response));
+static void REST_stream_request(const char *query, char *buffer, REST_stream_t *stream_ptr) {
+  uint32_t interval_ms = 0U;
 
-    /* check for path /data/sensors/wind */
-  } else if (strncmp(payload + URL_OFFSET, PATH_WIND_SENSOR,
-                     strlen(PATH_WIND_SENSOR)) == 0) {
+  if (strncmp(query, STREAM_INTERVAL_PARAM, strlen(STREAM_INTERVAL_PARAM)) == 0) {
+    interval_ms = strtoul(query + strlen(STREAM_INTERVAL_PARAM), NULL, 10);
+    if (interval_ms < STREAM_MIN_INTERVAL) {
+      interval_ms = STREAM_MIN_INTERVAL;
+    } else if (interval_ms > STREAM_MAX_INTERVAL) {
+      interval_ms = STREAM_MAX_INTERVAL;
+    }
+  }
+  stream_ptr->is_requested = True;
+  stream_ptr->interval_ms = interval_ms;
+  strcpy(buffer, STREAM_HEADER);
+}
 
-    REST_create_wind_json(response);
-    cJSON_PrintPreallocated(response, JSON_response, 200, 1);
-    REST_create_HTTP_header(buffer, HTTP_OK, strlen(JSON_response));
+static void REST_websocket_request(const char *payload, char *buffer, REST_stream_t *stream_ptr) {
+  size_t key_length = 0U;
+  const char *key = REST_find_header_field(payload, WEBSOCKET_KEY, &key_length);
 
-    /* check for path /data/status/operating_mode */
-  } else if (strncmp(payload + URL_OFFSET, PATH_WIND_SENSOR,
-                    strlen(PATH_WIND_SENSOR)) == 0) {
+  if (key == NULL || key_length == 0U) {
+    REST_create_HTTP_header(buffer, HTTP_Bad_Request, 0);
+    return;
+  }
+  /* the state is pushed on change, like an event stream without interval */
+  stream_ptr->is_requested = True;
+  stream_ptr->is_websocket = True;
+  stream_ptr->interval_ms = 0U;
+  strcpy(buffer, WEBSOCKET_HEADER);
+  WebSocket_create_accept(key, key_length, buffer + strlen(buffer));
+  strcat(buffer, END_OF_HEADER);
+}
 
-   REST_create_wind_json(response);
-   cJSON_PrintPreallocated(response, JSON_response, 200, 1);
-   REST_create_HTTP_header(buffer, HTTP_OK, strlen(JSON_response));
+static const char* REST_find_header_field(const char *payload, const char *field, size_t *length) {
+  const char *end_of_header = strstr(payload, END_OF_HEADER);
+  const char *line = strstr(payload, "\r\n");
+  const char *line_end;
+  const char *value;
+
+  while (end_of_header != NULL && line != NULL && line < end_of_header) {
+    line += strlen("\r\n");
+    line_end = strstr(line, "\r\n");
+    if (REST_header_field_matches(line, field) == 1U) {
+      value = line + strlen(field);
+      while (value < line_end && (*value == ' ' || *value == '\t')) {
+        value++;
+      }
+      *length = line_end - value;
+      while (*length > 0U && (value[*length - 1U] == ' ' || value[*length - 1U] == '\t')) {
+        (*length)--;
+      }
+      return value;
+    }
+    line = line_end;
+  }
+  return NULL;
+}
 
-   /* check for path /data/status/operating_mode */
- } else if (strncmp(payload + URL_OFFSET, PATH_SETTINGS, strlen(PATH_SETTINGS)) == 0) {
+size_t REST_create_stream_event(char *buffer, size_t size) {
+  JSON_Writer_t writer;
+  size_t length = 0U;
 
-    REST_create_settings_json(response);
-    cJSON_PrintPreallocated(response, JSON_response, 200, 1);
-    REST_create_HTTP_header(buffer, HTTP_OK, strlen(JSON_response));
-  } else if (strncmp(payload + URL_OFFSET, PATH_MODE,
-                     strlen(PATH_MODE)) == 0) {
+  if (size <= strlen(STREAM_EVENT_DATA) + strlen(STREAM_END_OF_EVENT)) {
+    return 0U;
+  }
+  Telemetry_get_snapshot(&REST_snapshot);
+  strcpy(buffer, STREAM_EVENT_DATA);
+  JSON_Writer_init(&writer, buffer + strlen(STREAM_EVENT_DATA),
+                   size - strlen(STREAM_EVENT_DATA) - strlen(STREAM_END_OF_EVENT));
+  JSON_Writer_begin_object(&writer, NULL);
+  REST_create_data_json(&writer);
+  JSON_Writer_end_object(&writer);
+  length = JSON_Writer_finish(&writer);
+  if (length == 0U) {
+    return 0U;
+  }
+  length += strlen(STREAM_EVENT_DATA);
+  strcpy(buffer + length, STREAM_END_OF_EVENT);
+  return length + strlen(STREAM_END_OF_EVENT);
+}
 
-    cJSON_AddNumberToObject(response, KEY_MODE, REST_linear_guide->operating_mode);
-    cJSON_PrintPreallocated(response, JSON_response, 200, 1);
-    REST_create_HTTP_header(buffer, HTTP_OK, strlen(JSON_response));
+size_t REST_create_websocket_event(char *buffer, size_t size) {
+  JSON_Writer_t writer;
+  size_t length = 0U;
 
-  } else {
-    REST_create_HTTP_header(buffer, HTTP_Not_Found, 0);
+  if (size <= WEBSOCKET_MAX_HEADER_SIZE) {
+    return 0U;
   }
+  /* all fields of the batch json, written behind the space of the frame header */
+  Telemetry_get_snapshot(&REST_snapshot);
+  REST_query = "";
+  JSON_Writer_init(&writer, buffer + WEBSOCKET_MAX_HEADER_SIZE, size - WEBSOCKET_MAX_HEADER_SIZE);
+  JSON_Writer_begin_object(&writer, NULL);
+  REST_create_batch_json(&writer);
+  JSON_Writer_end_object(&writer);
+  length = JSON_Writer_finish(&writer);
+  if (length == 0U) {
+    return 0U;
+  }
+  length = WebSocket_encode((uint8_t*) buffer, size, WEBSOCKET_OPCODE_TEXT, buffer + WEBSOCKET_MAX_HEADER_SIZE, length);
+  buffer[length] = '\0';
+  return length;
+}
 
-  cJSON_Delete(response);
-  strcat(buffer, JSON_response);
+size_t REST_websocket_command(const char *payload, char *buffer, size_t size) {
+  cJSON_Hooks arena_hooks = { REST_arena_malloc, REST_arena_free };
+  const char *result = WEBSOCKET_RESULT_INVALID;
+  uint8_t check_result;
+
+  /* same members and checks as a PUT of /data/batch */
+  Arena_reset(&REST_arena);
+  cJSON_InitHooks(&arena_hooks);
+  cJSON *request = cJSON_Parse(payload);
+  if (request != NULL) {
+    /* the members are handed to the control task together or not at all */
+    Command_begin();
+    check_result = REST_check_batch_json(request, True);
+    if (check_result == 0U) {
+      Command_commit();
+    }
+    switch (check_result) {
+      case 0U:
+        result = WEBSOCKET_RESULT_OK;
+        break;
+      case REST_CHECK_BUSY:
+        result = WEBSOCKET_RESULT_BUSY;
+        break;
+      case REST_CHECK_DENIED:
+        result = WEBSOCKET_RESULT_DENIED;
+        break;
+      default:
+        break;
+    }
+  }
+  cJSON_Delete(request);
+  cJSON_InitHooks(NULL);
+  Arena_reset(&REST_arena);
+  return WebSocket_encode((uint8_t*) buffer, size, WEBSOCKET_OPCODE_TEXT, result, strlen(result));
 }
 
-static void REST_put_request(char *payload, char *buffer) {
+static void REST_put_request(const REST_route_t *route, char *payload, char *buffer) {
 
   char *pEndOfHeader;
+  cJSON_Hooks arena_hooks = { REST_arena_malloc, REST_arena_free };
+  uint8_t result;
 
   pEndOfHeader = strstr(payload, END_OF_HEADER);
+  /* the request tree lives in the arena only, other cJSON users keep the heap */
+  Arena_reset(&REST_arena);
+  cJSON_InitHooks(&arena_hooks);
   cJSON *request = cJSON_Parse(pEndOfHeader);
 
   /*check for valid JSON format*/
-  if (request == NULL) {
+  if (request == NULL && REST_arena.is_exhausted) {
+
+    REST_create_HTTP_header(buffer, HTTP_Payload_Too_Large, 0);
+  } else if (request == NULL) {
 
     REST_create_HTTP_header(buffer, HTTP_Bad_Request, 0);
 
   } else {
 
-    /* check for path /data/status/error */
-    if (strncmp(payload + URL_OFFSET, PATH_ERROR, strlen(PATH_ERROR)) == 0) {
-
-      if (REST_check_error_json(request) != 1) {
-        REST_create_HTTP_header(buffer, HTTP_OK, 0);
-      } else {
-
-        REST_create_HTTP_header(buffer, HTTP_Bad_Request, 0);
-      }
-
-      /* check for path /data/status/adjustment */
-    } else if (strncmp(payload + URL_OFFSET, PATH_SAIL_STATE,
-                       strlen(PATH_SAIL_STATE)) == 0) {
-
-      if (REST_check_sailstate_json(request) != 1) {
-
-        REST_create_HTTP_header(buffer, HTTP_OK, 0);
-      } else {
-
-        REST_create_HTTP_header(buffer, HTTP_Bad_Request, 0);
-      }
-
-      /* check for path /data/status/operating_mode */
-    } else if (strncmp(payload + URL_OFFSET, PATH_MODE, strlen(PATH_MODE))
-        == 0) {
-      if (REST_check_mode_json(request) != 1) {
-
-        REST_create_HTTP_header(buffer, HTTP_OK, 0);
-      } else {
-
-        REST_create_HTTP_header(buffer, HTTP_Bad_Request, 0);
-      }
-
-    } else if (strncmp(payload + URL_OFFSET, PATH_SETTINGS, strlen(PATH_SETTINGS))
-        == 0) {
-      if (REST_check_settings_json(request) != 1) {
-
-        REST_create_HTTP_header(buffer, HTTP_OK, 0);
-      } else {
-
-        REST_create_HTTP_header(buffer, HTTP_Bad_Request, 0);
-      }
-
+    /* the commands of the request are handed to the control task together or not at all */
+    Command_begin();
+    result = route->put_handler(request, True);
+    if (result == 0U) {
+      Command_commit();
+      REST_create_HTTP_header(buffer, HTTP_OK, 0);
+    } else if (result == REST_CHECK_BUSY) {
+      REST_create_HTTP_header(buffer, HTTP_Service_Unavailable, 0);
+    } else if (result == REST_CHECK_DENIED) {
+      REST_create_HTTP_header(buffer, HTTP_Conflict, 0);
     } else {
-
-      REST_create_HTTP_header(buffer, HTTP_Not_Found, 0);
+      REST_create_HTTP_header(buffer, HTTP_Bad_Request, 0);
     }
   }
   cJSON_Delete(request);
+  cJSON_InitHooks(NULL);
+  Arena_reset(&REST_arena);
+}
+
+static void* REST_arena_malloc(size_t size) {
+  return Arena_alloc(&REST_arena, size);
+}
+
+static void REST_arena_free(void *pointer) {
+  (void) pointer;
 }
 
 static void REST_create_HTTP_header(char *buffer, http_responses_t response,
@@ -330,6 +820,9 @@ static void REST_create_HTTP_header(char *buffer, http_responses_t response,
     case HTTP_OK:
       strcat(buffer, HTTP_SUCCESS);
       break;
+    case HTTP_Not_Modified:
+      strcat(buffer, HTTP_NOT_MODIFIED);
+      break;
     case HTTP_Not_Implemented:
       strcat(buffer, HTTP_NOT_IMPLEMENTED);
       break;
@@ -339,6 +832,21 @@ static void REST_create_HTTP_header(char *buffer, http_responses_t response,
     case HTTP_Bad_Request:
       strcat(buffer, HTTP_BAD_REQ);
       break;
+    case HTTP_Method_Not_Allowed:
+      strcat(buffer, HTTP_NOT_ALLOWED);
+      break;
+    case HTTP_Payload_Too_Large:
+      strcat(buffer, HTTP_TOO_LARGE);
+      break;
+    case HTTP_Internal_Error:
+      strcat(buffer, HTTP_INTERNAL_ERROR);
+      break;
+    case HTTP_Conflict:
+      strcat(buffer, HTTP_CONFLICT);
+      break;
+    case HTTP_Service_Unavailable:
+      strcat(buffer, HTTP_UNAVAILABLE);
+      break;
     default:
       assert(response > HTTP_Not_Found);
       break;
@@ -350,62 +858,161 @@ static void REST_create_HTTP_header(char *buffer, http_responses_t response,
   strcat(buffer, END_OF_HEADER);
 }
 
-static void REST_create_status_json(cJSON *response) {
-  cJSON_AddNumberToObject(response, KEY_ERROR, Linear_Guide_get_error());
-  cJSON_AddNumberToObject(response, KEY_MODE, REST_linear_guide->operating_mode);
-  cJSON_AddNumberToObject(response, KEY_LOCALIZED, REST_linear_guide->localization.is_localized);
+static void REST_create_status_json(JSON_Writer_t *writer) {
+  REST_create_error_json(writer);
+  REST_create_mode_json(writer);
+  REST_create_localized_json(writer);
+}
+
+static void REST_create_error_json(JSON_Writer_t *writer) {
+  JSON_Writer_add_int(writer, KEY_ERROR, REST_snapshot.error_state);
+}
+
+static void REST_create_localized_json(JSON_Writer_t *writer) {
+  JSON_Writer_add_int(writer, KEY_LOCALIZED, REST_snapshot.is_localized);
+}
+
+static void REST_create_position_json(JSON_Writer_t *writer) {
+  /* mm with the um resolution of the localization */
+  JSON_Writer_add_fixed(writer, KEY_POSITION, REST_snapshot.current_pos_um, 3U);
+}
+
+static void REST_create_movement_json(JSON_Writer_t *writer) {
+  JSON_Writer_add_int(writer, KEY_MOVEMENT, REST_snapshot.movement);
+}
+
+static void REST_create_endswitches_json(JSON_Writer_t *writer) {
+  JSON_Writer_begin_object(writer, KEY_ENDSWITCHES);
+  JSON_Writer_add_uint(writer, KEY_FRONT, REST_snapshot.is_front_endswitch_detected);
+  JSON_Writer_add_uint(writer, KEY_BACK, REST_snapshot.is_back_endswitch_detected);
+  JSON_Writer_end_object(writer);
 }
 
-static void REST_create_data_json(cJSON *response) {
-  cJSON_AddNumberToObject(response, KEY_ERROR, Linear_Guide_get_error());
-  cJSON_AddNumberToObject(response, KEY_MODE, REST_linear_guide->operating_mode);
-  cJSON_AddNumberToObject(response, KEY_LOCALIZED, REST_linear_guide->localization.is_localized);
+static void REST_create_batch_json(JSON_Writer_t *writer) {
+  const char *fields = NULL;
+  size_t length = 0U;
 
-  REST_create_adjustment(response);
+  if (strncmp(REST_query, BATCH_FIELDS_PARAM, strlen(BATCH_FIELDS_PARAM)) == 0) {
+    fields = REST_query + strlen(BATCH_FIELDS_PARAM);
+    length = strcspn(fields, " &\r\n");
+  }
+  /* unknown field names are ignored */
+  for (size_t i = 0U; i < sizeof(REST_batch_fields) / sizeof(REST_batch_fields[0]); i++) {
+    if (fields == NULL || REST_is_field_listed(fields, length, REST_batch_fields[i].key) == 1U) {
+      REST_batch_fields[i].get_handler(writer);
+    }
+  }
+}
+
+static uint8_t REST_is_field_listed(const char *fields, size_t length, const char *key) {
+  size_t key_length = strlen(key);
+  size_t field_length;
+
+  while (length > 0U) {
+    field_length = 0U;
+    while (field_length < length && fields[field_length] != BATCH_FIELD_SEPARATOR) {
+      field_length++;
+    }
+    if (field_length == key_length && strncmp(fields, key, key_length) == 0) {
+      return 1U;
+    }
+    /* skip the field and its separator */
+    field_length = (field_length < length) ? field_length + 1U : field_length;
+    fields += field_length;
+    length -= field_length;
+  }
+  return 0U;
+}
+
+static void REST_create_data_json(JSON_Writer_t *writer) {
+  REST_create_status_json(writer);
+
+  REST_create_adjustment(writer);
+
+  REST_create_wind_json(writer);
+
+  REST_create_current_json(writer);
+}
 
-  REST_create_wind_json(response);
+static void REST_create_sensors_json(JSON_Writer_t *writer) {
+  REST_create_wind_json(writer);
+  REST_create_current_json(writer);
+}
 
-  IO_Get_Measured_Value(REST_current_sensor);
-  cJSON_AddNumberToObject(response, KEY_CURRENT, REST_current_sensor->measured_value);
+static void REST_create_current_json(JSON_Writer_t *writer) {
+  JSON_Writer_add_uint(writer, KEY_CURRENT, REST_snapshot.current_mA);
 }
 
-static void REST_create_sensors_json(cJSON *response) {
-  REST_create_wind_json(response);
-  IO_Get_Measured_Value(REST_current_sensor);
-  cJSON_AddNumberToObject(response, KEY_CURRENT, REST_current_sensor->measured_value);
+static void REST_create_wind_sensor_json(JSON_Writer_t *writer) {
+  REST_create_wind_json(writer);
+  REST_create_wind_summary_json(writer);
 }
 
-static void REST_create_wind_json(cJSON *response) {
-  cJSON *wind;
-  cJSON *wind_members;
-  char NMEA_telegram[30];
-  float wind_speed;
-  float wind_dir;
+static void REST_create_wind_json(JSON_Writer_t *writer) {
+  const WSWD_wind_sample_t *wind_sample = &REST_snapshot.wind_sample;
+
+  JSON_Writer_begin_array(writer, KEY_WIND);
+  JSON_Writer_begin_object(writer, NULL);
+  JSON_Writer_add_fixed(writer, KEY_SPEED, (int32_t) wind_sample->speed_x100, 2U);
+  JSON_Writer_add_fixed(writer, KEY_DIR, wind_sample->direction_x10, 1U);
+  JSON_Writer_end_object(writer);
+  JSON_Writer_end_array(writer);
+}
 
-  wind = cJSON_AddArrayToObject(response, KEY_WIND);
-  wind_members = cJSON_CreateObject();
+static void REST_create_wind_summary_json(JSON_Writer_t *writer) {
+  const Wind_History_statistics_t *statistics;
+  const Wind_History_gust_t *gust = &REST_snapshot.gust;
+  char unit[2] = { 0 };
+
+  unit[0] = (char) REST_snapshot.wind_sample.unit;
+  JSON_Writer_add_string(writer, KEY_UNIT, unit);
+
+  JSON_Writer_begin_array(writer, KEY_WINDOWS);
+  for (Wind_History_window_t window = Wind_History_window_short;
+      window < Wind_History_num_of_windows; window++) {
+    statistics = &REST_snapshot.wind_statistics[window];
+    JSON_Writer_begin_object(writer, NULL);
+    JSON_Writer_add_uint(writer, KEY_DURATION, statistics->duration_ms);
+    JSON_Writer_add_uint(writer, KEY_SAMPLES, statistics->num_of_samples);
+    JSON_Writer_add_fixed(writer, KEY_MEAN, (int32_t) statistics->mean_speed_x100, 2U);
+    JSON_Writer_add_fixed(writer, KEY_MAX, (int32_t) statistics->max_speed_x100, 2U);
+    JSON_Writer_add_fixed(writer, KEY_VARIANCE, (int32_t) statistics->speed_variance_x10000, 4U);
+    JSON_Writer_add_fixed(writer, KEY_DIR, statistics->mean_direction_x10, 1U);
+    JSON_Writer_add_fixed(writer, KEY_STEADINESS, statistics->steadiness_x1000, 3U);
+    JSON_Writer_end_object(writer);
+  }
+  JSON_Writer_end_array(writer);
+
+  JSON_Writer_begin_object(writer, KEY_GUST);
+  JSON_Writer_add_uint(writer, KEY_ACTIVE, gust->is_active);
+  JSON_Writer_add_uint(writer, KEY_COUNT, gust->count);
+  JSON_Writer_add_fixed(writer, KEY_PEAK, (int32_t) gust->peak_speed_x100, 2U);
+  JSON_Writer_add_uint(writer, KEY_AGE, gust->count == 0U ? 0U : REST_snapshot.timestamp_ms - gust->timestamp_ms);
+  JSON_Writer_end_object(writer);
+}
 
-  WSWD_receive_NMEA(NMEA_telegram);
-  WSWD_get_wind_infos(NMEA_telegram, &wind_speed, &wind_dir);
+static void REST_create_adjustment(JSON_Writer_t *writer)
+{
+	JSON_Writer_add_int(writer, KEY_SAIL_POS, REST_snapshot.roll_pitch_percentage);
+}
 
-  cJSON_AddNumberToObject(wind_members, KEY_SPEED, wind_speed);
-  cJSON_AddNumberToObject(wind_members, KEY_DIR, wind_dir);
-  cJSON_AddItemToArray(wind, wind_members);
+static void REST_create_mode_json(JSON_Writer_t *writer) {
+  JSON_Writer_add_int(writer, KEY_MODE, REST_snapshot.operating_mode);
 }
 
-static void REST_create_adjustment(cJSON *response)
+static void REST_create_settings_json(JSON_Writer_t *writer)
 {
-	int8_t roll_pitch_percentage = Linear_Guide_get_current_roll_pitch_percentage(*REST_linear_guide);
-	cJSON_AddNumberToObject(response, KEY_SAIL_POS, roll_pitch_percentage);
+  JSON_Writer_add_uint(writer, KEY_MAX_RPM, REST_snapshot.max_rpm);
+  JSON_Writer_add_uint(writer, KEY_MAX_DISTANCE, REST_snapshot.max_distance_error);
 }
 
-static void REST_create_settings_json(cJSON *response)
+static void REST_create_udp_settings_json(JSON_Writer_t *writer)
 {
-  cJSON_AddNumberToObject(response, KEY_MAX_RPM, REST_linear_guide->motor.normal_rpm);
-  cJSON_AddNumberToObject(response, KEY_MAX_DISTANCE, REST_linear_guide->max_distance_fault);
+  /* the publisher runs in the main loop like the REST server, no snapshot needed */
+  JSON_Writer_add_uint(writer, KEY_UDP_INTERVAL, udp_publisher_get_interval());
 }
 
-static uint8_t REST_check_error_json(cJSON *error_json) {
+static uint8_t REST_check_error_json(cJSON *error_json, boolean_t apply) {
   cJSON *error = cJSON_GetObjectItemCaseSensitive(error_json, KEY_ERROR);
   /* Check for number of keys */
   if (!(cJSON_GetArraySize(error) < 2)) {
@@ -416,22 +1023,21 @@ static uint8_t REST_check_error_json(cJSON *error_json) {
     return 1;
   }
   /* Check for error value */
-  if ((error->valueint != 2) || (error->valueint != 0)) {
+  if ((error->valueint != 2) && (error->valueint != 0)) {
     return 1;
   }
-  if(error->valueint == 2)
-  {
-    Linear_Guide_set_error(LG_error_state_2_wind_speed_fault);
+  if (apply == False) {
+    return 0;
   }
-  else
+  /* Format is valid */
+  if(error->valueint == 2)
   {
-    Linear_Guide_set_error(LG_error_state_0_normal);
+    return REST_get_command_result(Command_add(Command_set_error, LG_error_state_2_wind_speed_fault));
   }
-  /* Format is valid */
-  return 0;
+  return REST_get_command_result(Command_add(Command_set_error, LG_error_state_0_normal));
 }
 
-static uint8_t REST_check_sailstate_json(cJSON *sailstate_json) {
+static uint8_t REST_check_sailstate_json(cJSON *sailstate_json, boolean_t apply) {
   cJSON *sail_pos = cJSON_GetObjectItemCaseSensitive(sailstate_json, KEY_SAIL_POS);
 
   /* Check for number of keys */
@@ -445,13 +1051,15 @@ static uint8_t REST_check_sailstate_json(cJSON *sailstate_json) {
     /* Check for value range */
     if (-100 <= sail_pos->valueint && sail_pos->valueint <= 100) {
     	/* Format is valid */
-    	Linear_Guide_set_desired_roll_pitch_percentage(REST_linear_guide, sail_pos->valueint);
+    	if (apply == True) {
+    	  return REST_get_command_result(Command_add(Command_set_sail_pos, sail_pos->valueint));
+    	}
     	return 0;
     }
     return 1;
 }
 
-static uint8_t REST_check_mode_json(cJSON *mode_json) {
+static uint8_t REST_check_mode_json(cJSON *mode_json, boolean_t apply) {
   cJSON *operating_mode = cJSON_GetObjectItemCaseSensitive(mode_json,
   KEY_MODE);
   /* Check for number of keys */
@@ -467,12 +1075,15 @@ static uint8_t REST_check_mode_json(cJSON *mode_json) {
     return 1;
   }
   /* Format is valid */
-  Linear_Guide_set_operating_mode(REST_linear_guide, operating_mode->valueint);
+  if (apply == True) {
+    return REST_get_command_result(Command_add(Command_set_operating_mode, operating_mode->valueint));
+  }
   return 0;
 }
 
-static uint8_t REST_check_settings_json(cJSON *settings_json)
+static uint8_t REST_check_settings_json(cJSON *settings_json, boolean_t apply)
 {
+  uint8_t result;
 
   cJSON *max_rpm = cJSON_GetObjectItemCaseSensitive(settings_json,
   KEY_MAX_RPM);
@@ -497,9 +1108,82 @@ static uint8_t REST_check_settings_json(cJSON *settings_json)
     return 1;
   }
   /* Format is valid */
-  REST_linear_guide->max_distance_fault = (uint8_t)max_distance_error->valueint;
-  REST_linear_guide->motor.normal_rpm = (uint16_t)max_rpm->valueint;
-  FRAM_write(&REST_linear_guide->max_distance_fault, FRAM_MAX_DELTA, 1U);
-  FRAM_write((uint8_t*)&REST_linear_guide->motor.normal_rpm, FRAM_MAX_RPM, sizeof(REST_linear_guide->motor.normal_rpm));
+  if (apply == False) {
+    return 0;
+  }
+  result = REST_get_command_result(Command_add(Command_set_max_distance_error, max_distance_error->valueint));
+  if (result != 0U) {
+    return result;
+  }
+  return REST_get_command_result(Command_add(Command_set_max_rpm, max_rpm->valueint));
+}
+
+static uint8_t REST_check_udp_settings_json(cJSON *udp_json, boolean_t apply)
+{
+  cJSON *interval = cJSON_GetObjectItemCaseSensitive(udp_json, KEY_UDP_INTERVAL);
+
+  /* Check for number of keys */
+  if (!(cJSON_GetArraySize(udp_json) < 2)) {
+    return 1;
+  }
+  if (!cJSON_IsNumber(interval)) {
+    return 1;
+  }
+  if ((interval->valueint < (int) UDP_PUBLISHER_MIN_INTERVAL_MS) || (interval->valueint > (int) UDP_PUBLISHER_MAX_INTERVAL_MS)) {
+    return 1;
+  }
+  /* Format is valid, the publisher is not part of the control task, so no command is queued */
+  if (apply == True) {
+    udp_publisher_set_interval((uint16_t) interval->valueint);
+  }
+  return 0;
+}
+
+static uint8_t REST_check_batch_json(cJSON *batch_json, boolean_t apply) {
+  const cJSON *member = NULL;
+  const REST_batch_field_t *field;
+  size_t i;
+  uint8_t result;
+  uint32_t members_seen = 0U;  /* bit i: REST_batch_fields[i] is in the batch */
+
+  if (cJSON_GetArraySize(batch_json) == 0) {
+    return 1;
+  }
+  /* every member has to be writable, valid and unique before the first one is applied,
+   * a repeated key would only validate its first occurrence */
+  cJSON_ArrayForEach(member, batch_json) {
+    field = NULL;
+    for (i = 0U; i < sizeof(REST_batch_fields) / sizeof(REST_batch_fields[0]); i++) {
+      if (REST_batch_fields[i].put_handler != NULL && member->string != NULL
+          && strcmp(member->string, REST_batch_fields[i].key) == 0) {
+        field = &REST_batch_fields[i];
+        break;
+      }
+    }
+    if (field == NULL || (members_seen & (1UL << i)) != 0U
+        || field->put_handler(batch_json, False) == 1) {
+      return 1;
+    }
+    members_seen |= 1UL << i;
+  }
+  if (apply == False) {
+    return 0;
+  }
+  for (i = 0U; i < sizeof(REST_batch_fields) / sizeof(REST_batch_fields[0]); i++) {
+    if (REST_batch_fields[i].put_handler != NULL
+        && cJSON_GetObjectItemCaseSensitive(batch_json, REST_batch_fields[i].key) != NULL) {
+      result = REST_batch_fields[i].put_handler(batch_json, True);
+      if (result != 0U) {
+        return result;
+      }
+    }
+  }
   return 0;
 }
+
+static uint8_t REST_get_command_result(int8_t result) {
+  if (result == COMMAND_QUEUE_FULL) {
+    return REST_CHECK_BUSY;
+  }
+  return (result == COMMAND_DENIED) ? REST_CHECK_DENIED : 0U;
+}
@@ -8,13 +8,60 @@
 #ifndef REST_REST_H_
 #define REST_REST_H_
 
+#include <stddef.h>
+#include <stdint.h>
+#include "boolean.h"
+
+#define REST_RESPONSE_SIZE    720U  /* header and body of the largest response (/data/sensors/wind) */
+
+/** @struct REST_stream_t
+ *  @brief  event stream requested by a GET of a stream route
+ *  @var REST_stream_t::is_requested
+ *  the response only contains the header, the events follow with REST_create_stream_event
+ *  @var REST_stream_t::is_websocket
+ *  the connection was upgraded to a WebSocket, the events follow with REST_create_websocket_event
+ *  @var REST_stream_t::interval_ms
+ *  period of the events, 0: send an event when the data changes
+ */
+typedef struct {
+  boolean_t is_requested;
+  boolean_t is_websocket;
+  uint32_t interval_ms;
+} REST_stream_t;
+
 /**
  * @brief  Handles incoming HTTP requests
  * @param  payload: pointer to received payload
- * @param  buffer: pointer to http response buffer
+ * @param  buffer: pointer to http response buffer of REST_RESPONSE_SIZE bytes
+ * @param  stream_ptr: set if the request starts an event stream
  * @retval none
  */
-void REST_request_handler(char *payload, char *buffer);
+void REST_request_handler(char *payload, char *buffer, REST_stream_t *stream_ptr);
+
+/**
+ * @brief  Builds one server-sent event of the event stream (/data json)
+ * @param  buffer: pointer to the event buffer
+ * @param  size: size of the event buffer
+ * @retval length of the event, 0 if it does not fit
+ */
+size_t REST_create_stream_event(char *buffer, size_t size);
+
+/**
+ * @brief  Builds one WebSocket text frame with the state (/data/batch json of all fields)
+ * @param  buffer: pointer to the frame buffer
+ * @param  size: size of the frame buffer
+ * @retval length of the frame, 0 if it does not fit
+ */
+size_t REST_create_websocket_event(char *buffer, size_t size);
+
+/**
+ * @brief  Applies the JSON of a WebSocket text frame like a PUT of /data/batch
+ * @param  payload: null terminated text of the frame
+ * @param  buffer: pointer to the buffer of the result frame ({"result":"ok"}, "invalid", "busy" or "denied")
+ * @param  size: size of the buffer
+ * @retval length of the text frame with the result, 0 if it does not fit
+ */
+size_t REST_websocket_command(const char *payload, char *buffer, size_t size);
 
 /**
  * @brief  Gets required pointers to objects
@@ -23,4 +70,11 @@ void REST_request_handler(char *payload, char *buffer);
  */
 void REST_init(void);
 
+/**
+ * @brief  Gets the maximum number of bytes used by the cJSON tree of a PUT request
+ * @param  none
+ * @retval high-water mark of the request arena
+ */
+size_t REST_get_arena_high_water_mark(void);
+
 #endif /* REST_REST_H_ */
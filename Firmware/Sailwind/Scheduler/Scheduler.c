@@ -0,0 +1,214 @@
+/**
+ * \file Scheduler.c
+ * @date 17 Oct 2026
+ * @brief Fixed-rate scheduler driven by a 1 ms hardware timer tick
+ */
+#include <stddef.h>
+#include "Scheduler.h"
+
+/* defines -----------------------------------------------------------*/
+#define SCHEDULER_LOCK_BASEPRI  (SCHEDULER_TICK_IRQ_PRIORITY << (8U - __NVIC_PRIO_BITS))
+
+/* private variables -----------------------------------------------*/
+static Scheduler_task_t Scheduler_tasks[SCHEDULER_MAX_TASKS];
+static uint8_t Scheduler_num_of_tasks = 0U;
+static uint8_t Scheduler_background_index = 0U;
+static TIM_HandleTypeDef *Scheduler_htim_tick_ptr = NULL;
+
+/* private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief find the due periodic task of a context with the highest priority
+ * @param now_ms: current tick
+ * @param context: context of the caller
+ * @retval ptr to the task, NULL if no periodic task is due
+ */
+static Scheduler_task_t* Scheduler_get_next_task(uint32_t now_ms, Scheduler_context_t context);
+
+/**
+ * @brief run a periodic task and update its statistics and next release
+ * @param task_ptr: ptr to the task
+ * @param now_ms: tick of the start
+ * @retval none
+ */
+static void Scheduler_run_task(Scheduler_task_t *task_ptr, uint32_t now_ms);
+
+/**
+ * @brief run the next background task of the main loop
+ * @param none
+ * @retval none
+ */
+static void Scheduler_run_background(void);
+
+/* API function definitions -----------------------------------------------*/
+
+void Scheduler_init(TIM_HandleTypeDef *htim_tick_ptr)
+{
+  Scheduler_htim_tick_ptr = htim_tick_ptr;
+  /* the cycle counter measures the run time of the tasks */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  HAL_TIM_Base_Start_IT(Scheduler_htim_tick_ptr);
+}
+
+int8_t Scheduler_add_task(const char *name, Scheduler_function_t function, uint32_t period_ms,
+                          uint32_t deadline_ms, uint8_t priority, Scheduler_context_t context)
+{
+  Scheduler_task_t *task_ptr;
+
+  if (period_ms == SCHEDULER_BACKGROUND && context == Scheduler_context_tick_interrupt)
+  {
+    return SCHEDULER_INVALID;
+  }
+  if (Scheduler_num_of_tasks >= SCHEDULER_MAX_TASKS)
+  {
+    return SCHEDULER_FULL;
+  }
+  task_ptr = &Scheduler_tasks[Scheduler_num_of_tasks];
+  task_ptr->name = name;
+  task_ptr->function = function;
+  task_ptr->period_ms = period_ms;
+  task_ptr->deadline_ms = (deadline_ms == 0U) ? period_ms : deadline_ms;
+  task_ptr->priority = priority;
+  task_ptr->context = context;
+  task_ptr->release_ms = HAL_GetTick() + 1U;
+  task_ptr->num_of_runs = 0U;
+  task_ptr->num_of_deadline_misses = 0U;
+  task_ptr->num_of_skipped_releases = 0U;
+  task_ptr->max_latency_ms = 0U;
+  task_ptr->max_execution_cycles = 0U;
+  /* the tick interrupt sees the task only once it is complete */
+  __DMB();
+  Scheduler_num_of_tasks++;
+  return SCHEDULER_OK;
+}
+
+void Scheduler_run(void)
+{
+  uint32_t now_ms = HAL_GetTick();
+  Scheduler_task_t *task_ptr = Scheduler_get_next_task(now_ms, Scheduler_context_main_loop);
+
+  if (task_ptr != NULL)
+  {
+    Scheduler_run_task(task_ptr, now_ms);
+  }
+  else
+  {
+    Scheduler_run_background();
+  }
+}
+
+void Scheduler_tick_callback(TIM_HandleTypeDef *htim_ptr)
+{
+  uint32_t now_ms = HAL_GetTick();
+  Scheduler_task_t *task_ptr;
+
+  if (htim_ptr != Scheduler_htim_tick_ptr)
+  {
+    return;
+  }
+  /* run every due task, the clock is read again as the tasks take time */
+  while ((task_ptr = Scheduler_get_next_task(now_ms, Scheduler_context_tick_interrupt)) != NULL)
+  {
+    Scheduler_run_task(task_ptr, now_ms);
+    now_ms = HAL_GetTick();
+  }
+}
+
+uint32_t Scheduler_lock(void)
+{
+  uint32_t state = __get_BASEPRI();
+
+  /* only raises the mask, so a nested lock or a lock in the tick interrupt changes nothing */
+  __set_BASEPRI_MAX(SCHEDULER_LOCK_BASEPRI);
+  return state;
+}
+
+void Scheduler_unlock(uint32_t state)
+{
+  __set_BASEPRI(state);
+}
+
+const Scheduler_task_t* Scheduler_get_task(uint8_t index)
+{
+  return (index < Scheduler_num_of_tasks) ? &Scheduler_tasks[index] : NULL;
+}
+
+uint8_t Scheduler_get_num_of_tasks(void)
+{
+  return Scheduler_num_of_tasks;
+}
+
+/* private function definitions -----------------------------------------------*/
+
+static Scheduler_task_t* Scheduler_get_next_task(uint32_t now_ms, Scheduler_context_t context)
+{
+  Scheduler_task_t *next_ptr = NULL;
+  Scheduler_task_t *task_ptr;
+
+  for (uint8_t i = 0U; i < Scheduler_num_of_tasks; i++)
+  {
+    task_ptr = &Scheduler_tasks[i];
+    /* signed difference, the tick counter wraps after 49 days */
+    if (task_ptr->context != context || task_ptr->period_ms == SCHEDULER_BACKGROUND
+        || (int32_t) (now_ms - task_ptr->release_ms) < 0)
+    {
+      continue;
+    }
+    if (next_ptr == NULL || task_ptr->priority < next_ptr->priority
+        || (task_ptr->priority == next_ptr->priority && (int32_t) (task_ptr->release_ms - next_ptr->release_ms) < 0))
+    {
+      next_ptr = task_ptr;
+    }
+  }
+  return next_ptr;
+}
+
+static void Scheduler_run_task(Scheduler_task_t *task_ptr, uint32_t now_ms)
+{
+  uint32_t start_cycles = DWT->CYCCNT;
+  uint32_t execution_cycles;
+  uint32_t end_ms;
+  uint32_t num_of_missed_periods;
+
+  if (now_ms - task_ptr->release_ms > task_ptr->max_latency_ms)
+  {
+    task_ptr->max_latency_ms = now_ms - task_ptr->release_ms;
+  }
+  task_ptr->function();
+  execution_cycles = DWT->CYCCNT - start_cycles;
+  end_ms = HAL_GetTick();
+
+  task_ptr->num_of_runs++;
+  if (execution_cycles > task_ptr->max_execution_cycles)
+  {
+    task_ptr->max_execution_cycles = execution_cycles;
+  }
+  /* the task ended within the tick of its deadline at the latest */
+  if (end_ms - task_ptr->release_ms >= task_ptr->deadline_ms + 1U)
+  {
+    task_ptr->num_of_deadline_misses++;
+  }
+  /* fixed rate: the next release keeps the phase, releases that already passed are dropped */
+  task_ptr->release_ms += task_ptr->period_ms;
+  if ((int32_t) (end_ms - task_ptr->release_ms) >= (int32_t) task_ptr->period_ms)
+  {
+    num_of_missed_periods = (end_ms - task_ptr->release_ms) / task_ptr->period_ms;
+    task_ptr->release_ms += num_of_missed_periods * task_ptr->period_ms;
+    task_ptr->num_of_skipped_releases += num_of_missed_periods;
+  }
+}
+
+static void Scheduler_run_background(void)
+{
+  for (uint8_t i = 0U; i < Scheduler_num_of_tasks; i++)
+  {
+    Scheduler_background_index = (Scheduler_background_index + 1U) % Scheduler_num_of_tasks;
+    if (Scheduler_tasks[Scheduler_background_index].period_ms == SCHEDULER_BACKGROUND)
+    {
+      Scheduler_tasks[Scheduler_background_index].function();
+      Scheduler_tasks[Scheduler_background_index].num_of_runs++;
+      return;
+    }
+  }
+}
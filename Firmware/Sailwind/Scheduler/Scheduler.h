@@ -0,0 +1,146 @@
+/**
+ * \file Scheduler.h
+ * @date 17 Oct 2026
+ * @brief Fixed-rate scheduler driven by a 1 ms hardware timer tick
+ *
+ * Tasks run to completion in one of two contexts:
+ *  - tick interrupt: the timer interrupt starts the due tasks itself, so they preempt the main
+ *    loop at any point. Its priority (SCHEDULER_TICK_IRQ_PRIORITY) is below every other
+ *    interrupt, so the HAL tick, the UART reception and the pulse capture keep running.
+ *  - main loop: Scheduler_run starts the due task with the highest priority; background tasks
+ *    (period SCHEDULER_BACKGROUND) run one after another whenever no periodic task is due.
+ * Releases follow HAL_GetTick, a tick interrupt that is held up by a long task is not lost.
+ * Data shared between the contexts has to be handed over by a queue or guarded by
+ * Scheduler_lock.
+ */
+
+#ifndef SCHEDULER_SCHEDULER_H_
+#define SCHEDULER_SCHEDULER_H_
+
+#include <stdint.h>
+#include "stm32f4xx_hal.h"
+
+/* defines -----------------------------------------------------------*/
+#define SCHEDULER_MAX_TASKS           8U
+#define SCHEDULER_BACKGROUND          0U   /* period of a task that fills the slack */
+#define SCHEDULER_TICK_IRQ_PRIORITY   1U   /* preemption priority of the tick timer interrupt */
+#define SCHEDULER_OK                  0
+#define SCHEDULER_FULL                -1
+#define SCHEDULER_INVALID             -2
+
+/* typedefs -----------------------------------------------------------*/
+typedef void (*Scheduler_function_t)(void);
+
+typedef enum {
+  Scheduler_context_tick_interrupt,
+  Scheduler_context_main_loop
+} Scheduler_context_t;
+
+/** @struct Scheduler_task_t
+ *  @brief task and its run time statistics
+ *  @var Scheduler_task_t::name
+ *  name printed by the statistics test
+ *  @var Scheduler_task_t::function
+ *  runs the task to completion
+ *  @var Scheduler_task_t::period_ms
+ *  release period in ticks, SCHEDULER_BACKGROUND for background tasks
+ *  @var Scheduler_task_t::deadline_ms
+ *  latest completion after the release
+ *  @var Scheduler_task_t::priority
+ *  0 is the highest priority, tasks of the same priority run in the order of their release
+ *  @var Scheduler_task_t::context
+ *  where the task runs, the priority orders the tasks of one context
+ *  @var Scheduler_task_t::release_ms
+ *  tick of the next release, advanced by the period so the rate does not drift
+ *  @var Scheduler_task_t::num_of_runs
+ *  number of completed runs
+ *  @var Scheduler_task_t::num_of_deadline_misses
+ *  runs completed later than the deadline
+ *  @var Scheduler_task_t::num_of_skipped_releases
+ *  releases dropped because the previous run ended after the next period
+ *  @var Scheduler_task_t::max_latency_ms
+ *  longest delay between release and start
+ *  @var Scheduler_task_t::max_execution_cycles
+ *  longest run time in CPU cycles
+ */
+typedef struct {
+  const char *name;
+  Scheduler_function_t function;
+  uint32_t period_ms;
+  uint32_t deadline_ms;
+  uint8_t priority;
+  Scheduler_context_t context;
+  uint32_t release_ms;
+  uint32_t num_of_runs;
+  uint32_t num_of_deadline_misses;
+  uint32_t num_of_skipped_releases;
+  uint32_t max_latency_ms;
+  uint32_t max_execution_cycles;
+} Scheduler_task_t;
+
+/* API function prototypes -----------------------------------------------*/
+
+/**
+ * @brief start the tick timer, it has to be configured for an update event every millisecond
+ *        and its interrupt for the preemption priority SCHEDULER_TICK_IRQ_PRIORITY
+ * @param htim_tick_ptr: timer handle of the tick
+ * @retval none
+ */
+void Scheduler_init(TIM_HandleTypeDef *htim_tick_ptr);
+
+/**
+ * @brief add a task, it is released with the next tick
+ * @param name: name of the task
+ * @param function: task function
+ * @param period_ms: release period, SCHEDULER_BACKGROUND for a background task of the main loop
+ * @param deadline_ms: latest completion after the release, 0 for the period
+ * @param priority: 0 is the highest priority
+ * @param context: tick interrupt or main loop
+ * @retval SCHEDULER_OK, SCHEDULER_FULL or SCHEDULER_INVALID (background task in the tick interrupt)
+ */
+int8_t Scheduler_add_task(const char *name, Scheduler_function_t function, uint32_t period_ms,
+                          uint32_t deadline_ms, uint8_t priority, Scheduler_context_t context);
+
+/**
+ * @brief run the most urgent due task of the main loop, or the next background task (to be called in the main loop)
+ * @param none
+ * @retval none
+ */
+void Scheduler_run(void);
+
+/**
+ * @brief run the due tasks of the tick interrupt (to be called in the update interrupt callback of the tick timer)
+ * @param htim_ptr: timer handle of the interrupt
+ * @retval none
+ */
+void Scheduler_tick_callback(TIM_HandleTypeDef *htim_ptr);
+
+/**
+ * @brief keep the tasks of the tick interrupt from running until Scheduler_unlock, can be nested
+ * @param none
+ * @retval state to be passed to Scheduler_unlock
+ */
+uint32_t Scheduler_lock(void);
+
+/**
+ * @brief end a section started by Scheduler_lock
+ * @param state: return value of the matching Scheduler_lock
+ * @retval none
+ */
+void Scheduler_unlock(uint32_t state);
+
+/**
+ * @brief get a task with its statistics
+ * @param index: 0 ... Scheduler_get_num_of_tasks() - 1
+ * @retval ptr to the task, NULL if the index is invalid
+ */
+const Scheduler_task_t* Scheduler_get_task(uint8_t index);
+
+/**
+ * @brief get the number of added tasks
+ * @param none
+ * @retval number of tasks
+ */
+uint8_t Scheduler_get_num_of_tasks(void);
+
+#endif /* SCHEDULER_SCHEDULER_H_ */
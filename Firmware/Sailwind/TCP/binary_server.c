@@ -0,0 +1,212 @@
+/**
+ * \file binary_server.c
+ * @date 17 Oct 2026
+ * @brief tcp listener of the binary protocol
+ *
+ * Serves one client (the controllino) next to the REST listener. Frames may be split
+ * over several segments or arrive back to back, they are collected in a small receive buffer.
+ */
+
+#include "tcp.h"
+#include <string.h>
+#include "lwip.h"
+#include "boolean.h"
+#include "Binary_Protocol.h"
+#include "binary_server.h"
+
+#define BINARY_SERVER_PORT          2376
+#define BINARY_SERVER_POLL_INTERVAL 2U    /* in TCP coarse timer ticks (500 ms) */
+#define BINARY_SERVER_IDLE_POLLS    20U   /* close the connection after 10 s without request */
+#define BINARY_SERVER_RX_SIZE       (2U * BINARY_PROTOCOL_MAX_FRAME_SIZE)
+
+struct binary_server_struct {
+  struct tcp_pcb *pcb;   /* NULL: no client connected */
+  uint8_t idle_polls;
+  u16_t rx_length;
+  uint8_t rx[BINARY_SERVER_RX_SIZE];  /* received bytes of incomplete frames */
+};
+
+static struct binary_server_struct binary_server;
+
+/**
+ * @brief  This function is the implementation of tcp_accept LwIP callback
+ * @param  arg: not used
+ * @param  newpcb: pointer on tcp_pcb struct for the newly created tcp connection
+ * @param  err: not used
+ * @retval err_t: error status
+ */
+static err_t binary_server_accept(void *arg, struct tcp_pcb *newpcb, err_t err);
+
+/**
+ * @brief  This function is the implementation for tcp_recv LwIP callback
+ * @param  arg: not used
+ * @param  tpcb: pointer on the tcp_pcb connection
+ * @param  p: pointer on the received pbuf
+ * @param  err: error information regarding the reveived pbuf
+ * @retval err_t: error code
+ */
+static err_t binary_server_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err);
+
+/**
+ * @brief  This function answers every complete frame of the receive buffer
+ * @param  tpcb: pointer on the tcp_pcb connection
+ * @retval ERR_OK, or ERR_ABRT if the connection was aborted
+ */
+static err_t binary_server_handle(struct tcp_pcb *tpcb);
+
+/**
+ * @brief  This function implements the tcp_err callback function
+ * @param  arg: not used
+ * @param  err: not used
+ * @retval None
+ */
+static void binary_server_error(void *arg, err_t err);
+
+/**
+ * @brief  This function implements the tcp_poll LwIP callback function, it closes idle connections
+ * @param  arg: not used
+ * @param  tpcb: pointer on the tcp_pcb for the current tcp connection
+ * @retval err_t: error code
+ */
+static err_t binary_server_poll(void *arg, struct tcp_pcb *tpcb);
+
+/**
+ * @brief  This functions closes the tcp connection and frees the client slot
+ * @param  tpcb: pointer on the tcp connection
+ * @retval None
+ */
+static void binary_server_connection_close(struct tcp_pcb *tpcb);
+
+void binary_server_init(const ip_addr_t *ip_addr) {
+  struct tcp_pcb *tpcb = tcp_new();
+
+  memset(&binary_server, 0, sizeof(binary_server));
+  if (tpcb == NULL) {
+    return;
+  }
+  if (tcp_bind(tpcb, ip_addr, BINARY_SERVER_PORT) == ERR_OK) {
+    tpcb = tcp_listen(tpcb);
+    tcp_accept(tpcb, binary_server_accept);
+  } else {
+    /* deallocate the pcb */
+    memp_free(MEMP_TCP_PCB, tpcb);
+  }
+}
+
+static err_t binary_server_accept(void *arg, struct tcp_pcb *newpcb, err_t err) {
+  LWIP_UNUSED_ARG(arg);
+
+  if ((err != ERR_OK) || (newpcb == NULL)) {
+    return ERR_VAL;
+  }
+  if (binary_server.pcb != NULL) {
+    /* one client at a time, refuse the connection with a reset */
+    tcp_abort(newpcb);
+    return ERR_ABRT;
+  }
+  binary_server.pcb = newpcb;
+  binary_server.idle_polls = 0;
+  binary_server.rx_length = 0;
+
+  tcp_setprio(newpcb, TCP_PRIO_MIN);
+  /* the frames are small and answered at once, do not wait for more data */
+  tcp_nagle_disable(newpcb);
+  tcp_recv(newpcb, binary_server_recv);
+  tcp_err(newpcb, binary_server_error);
+  tcp_poll(newpcb, binary_server_poll, BINARY_SERVER_POLL_INTERVAL);
+  return ERR_OK;
+}
+
+static err_t binary_server_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err) {
+  u16_t offset = 0;
+  u16_t copy_length;
+
+  LWIP_UNUSED_ARG(arg);
+
+  if (p == NULL) {
+    /* remote host closed connection */
+    binary_server_connection_close(tpcb);
+    return ERR_OK;
+  }
+  if (err != ERR_OK) {
+    pbuf_free(p);
+    return err;
+  }
+  binary_server.idle_polls = 0;
+  /* a chain longer than the buffer is handled in portions, every portion completes at least one frame */
+  while (offset < p->tot_len) {
+    copy_length = LWIP_MIN(p->tot_len - offset, BINARY_SERVER_RX_SIZE - binary_server.rx_length);
+    pbuf_copy_partial(p, &binary_server.rx[binary_server.rx_length], copy_length, offset);
+    binary_server.rx_length += copy_length;
+    offset += copy_length;
+    if (binary_server_handle(tpcb) != ERR_OK) {
+      pbuf_free(p);
+      return ERR_ABRT;
+    }
+  }
+  tcp_recved(tpcb, p->tot_len);
+  pbuf_free(p);
+  tcp_output(tpcb);
+  return ERR_OK;
+}
+
+static err_t binary_server_handle(struct tcp_pcb *tpcb) {
+  Binary_Protocol_frame_t request;
+  Binary_Protocol_frame_t response;
+  uint8_t tx[BINARY_PROTOCOL_MAX_FRAME_SIZE];
+  size_t consumed = 0U;
+  size_t handled = 0U;
+  int8_t result;
+
+  while (handled < binary_server.rx_length) {
+    result = Binary_Protocol_decode(&binary_server.rx[handled], binary_server.rx_length - handled,
+                                    &request, &consumed);
+    handled += consumed;
+    if (result == BINARY_PROTOCOL_FRAME_INCOMPLETE) {
+      if (consumed == 0U) {
+        break;
+      }
+      continue;
+    }
+    if (result == BINARY_PROTOCOL_FRAME_COMPLETE) {
+      Binary_Protocol_handle(&request, &response);
+    } else {
+      Binary_Protocol_create_crc_error(&response);
+    }
+    if (tcp_write(tpcb, tx, Binary_Protocol_encode(&response, tx, sizeof(tx)), TCP_WRITE_FLAG_COPY) != ERR_OK) {
+      /* the client does not read its responses */
+      binary_server.pcb = NULL;
+      tcp_abort(tpcb);
+      return ERR_ABRT;
+    }
+  }
+  binary_server.rx_length -= handled;
+  memmove(binary_server.rx, &binary_server.rx[handled], binary_server.rx_length);
+  return ERR_OK;
+}
+
+static void binary_server_error(void *arg, err_t err) {
+  LWIP_UNUSED_ARG(arg);
+  LWIP_UNUSED_ARG(err);
+
+  /* the pcb is already freed by lwIP */
+  binary_server.pcb = NULL;
+}
+
+static err_t binary_server_poll(void *arg, struct tcp_pcb *tpcb) {
+  LWIP_UNUSED_ARG(arg);
+
+  if (++binary_server.idle_polls >= BINARY_SERVER_IDLE_POLLS) {
+    binary_server_connection_close(tpcb);
+  }
+  return ERR_OK;
+}
+
+static void binary_server_connection_close(struct tcp_pcb *tpcb) {
+  tcp_recv(tpcb, NULL);
+  tcp_err(tpcb, NULL);
+  tcp_poll(tpcb, NULL, 0);
+  binary_server.pcb = NULL;
+  binary_server.rx_length = 0;
+  tcp_close(tpcb);
+}
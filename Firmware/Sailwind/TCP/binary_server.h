@@ -0,0 +1,19 @@
+/**
+ * \file binary_server.h
+ * @date 17 Oct 2026
+ * @brief tcp listener of the binary protocol
+ */
+
+#ifndef TCP_BINARY_SERVER_H_
+#define TCP_BINARY_SERVER_H_
+
+#include "lwip/ip_addr.h"
+
+/**
+ * @brief  Starts listening for one binary protocol client on BINARY_SERVER_PORT
+ * @param  ip_addr: address the REST listener is bound to
+ * @retval None
+ */
+void binary_server_init(const ip_addr_t *ip_addr);
+
+#endif /* TCP_BINARY_SERVER_H_ */
@@ -0,0 +1,206 @@
+/**
+ * \file modbus_server.c
+ * @date 17 Oct 2026
+ * @brief tcp listener of Modbus TCP
+ *
+ * Serves one client (the PLC) next to the REST listener. Requests may be split over several
+ * segments or arrive back to back, they are collected in a receive buffer of one frame.
+ */
+
+#include "tcp.h"
+#include <string.h>
+#include "lwip.h"
+#include "boolean.h"
+#include "Modbus.h"
+#include "modbus_server.h"
+
+#define MODBUS_SERVER_PORT          502
+#define MODBUS_SERVER_POLL_INTERVAL 2U    /* in TCP coarse timer ticks (500 ms) */
+#define MODBUS_SERVER_IDLE_POLLS    120U  /* close the connection after 60 s without request */
+#define MODBUS_SERVER_RX_SIZE       MODBUS_MAX_ADU_SIZE
+
+struct modbus_server_struct {
+  struct tcp_pcb *pcb;   /* NULL: no client connected */
+  uint8_t idle_polls;
+  u16_t rx_length;
+  uint8_t rx[MODBUS_SERVER_RX_SIZE];  /* received bytes of an incomplete frame */
+};
+
+static struct modbus_server_struct modbus_server;
+
+/**
+ * @brief  This function is the implementation of tcp_accept LwIP callback
+ * @param  arg: not used
+ * @param  newpcb: pointer on tcp_pcb struct for the newly created tcp connection
+ * @param  err: not used
+ * @retval err_t: error status
+ */
+static err_t modbus_server_accept(void *arg, struct tcp_pcb *newpcb, err_t err);
+
+/**
+ * @brief  This function is the implementation for tcp_recv LwIP callback
+ * @param  arg: not used
+ * @param  tpcb: pointer on the tcp_pcb connection
+ * @param  p: pointer on the received pbuf
+ * @param  err: error information regarding the reveived pbuf
+ * @retval err_t: error code
+ */
+static err_t modbus_server_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err);
+
+/**
+ * @brief  This function answers every complete frame of the receive buffer
+ * @param  tpcb: pointer on the tcp_pcb connection
+ * @retval ERR_OK, or ERR_ABRT if the connection was aborted (the client does not read or sent an invalid header)
+ */
+static err_t modbus_server_handle(struct tcp_pcb *tpcb);
+
+/**
+ * @brief  This function implements the tcp_err callback function
+ * @param  arg: not used
+ * @param  err: not used
+ * @retval None
+ */
+static void modbus_server_error(void *arg, err_t err);
+
+/**
+ * @brief  This function implements the tcp_poll LwIP callback function, it closes idle connections
+ * @param  arg: not used
+ * @param  tpcb: pointer on the tcp_pcb for the current tcp connection
+ * @retval err_t: error code
+ */
+static err_t modbus_server_poll(void *arg, struct tcp_pcb *tpcb);
+
+/**
+ * @brief  This functions closes the tcp connection and frees the client slot
+ * @param  tpcb: pointer on the tcp connection
+ * @retval None
+ */
+static void modbus_server_connection_close(struct tcp_pcb *tpcb);
+
+void modbus_server_init(const ip_addr_t *ip_addr) {
+  struct tcp_pcb *tpcb = tcp_new();
+
+  memset(&modbus_server, 0, sizeof(modbus_server));
+  if (tpcb == NULL) {
+    return;
+  }
+  if (tcp_bind(tpcb, ip_addr, MODBUS_SERVER_PORT) == ERR_OK) {
+    tpcb = tcp_listen(tpcb);
+    tcp_accept(tpcb, modbus_server_accept);
+  } else {
+    /* deallocate the pcb */
+    memp_free(MEMP_TCP_PCB, tpcb);
+  }
+}
+
+static err_t modbus_server_accept(void *arg, struct tcp_pcb *newpcb, err_t err) {
+  LWIP_UNUSED_ARG(arg);
+
+  if ((err != ERR_OK) || (newpcb == NULL)) {
+    return ERR_VAL;
+  }
+  if (modbus_server.pcb != NULL) {
+    /* one client at a time, refuse the connection with a reset */
+    tcp_abort(newpcb);
+    return ERR_ABRT;
+  }
+  modbus_server.pcb = newpcb;
+  modbus_server.idle_polls = 0;
+  modbus_server.rx_length = 0;
+
+  tcp_setprio(newpcb, TCP_PRIO_MIN);
+  /* the responses are small and sent at once, do not wait for more data */
+  tcp_nagle_disable(newpcb);
+  tcp_recv(newpcb, modbus_server_recv);
+  tcp_err(newpcb, modbus_server_error);
+  tcp_poll(newpcb, modbus_server_poll, MODBUS_SERVER_POLL_INTERVAL);
+  return ERR_OK;
+}
+
+static err_t modbus_server_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err) {
+  u16_t offset = 0;
+  u16_t copy_length;
+
+  LWIP_UNUSED_ARG(arg);
+
+  if (p == NULL) {
+    /* remote host closed connection */
+    modbus_server_connection_close(tpcb);
+    return ERR_OK;
+  }
+  if (err != ERR_OK) {
+    pbuf_free(p);
+    return err;
+  }
+  modbus_server.idle_polls = 0;
+  /* a chain longer than the buffer is handled in portions, every portion completes at least one frame */
+  while (offset < p->tot_len) {
+    copy_length = LWIP_MIN(p->tot_len - offset, MODBUS_SERVER_RX_SIZE - modbus_server.rx_length);
+    pbuf_copy_partial(p, &modbus_server.rx[modbus_server.rx_length], copy_length, offset);
+    modbus_server.rx_length += copy_length;
+    offset += copy_length;
+    if (modbus_server_handle(tpcb) != ERR_OK) {
+      pbuf_free(p);
+      return ERR_ABRT;
+    }
+  }
+  tcp_recved(tpcb, p->tot_len);
+  pbuf_free(p);
+  tcp_output(tpcb);
+  return ERR_OK;
+}
+
+static err_t modbus_server_handle(struct tcp_pcb *tpcb) {
+  uint8_t tx[MODBUS_MAX_ADU_SIZE];
+  size_t frame_length = 0U;
+  size_t handled = 0U;
+  int8_t result = MODBUS_FRAME_INCOMPLETE;
+
+  while (handled < modbus_server.rx_length) {
+    result = Modbus_check_frame(&modbus_server.rx[handled], modbus_server.rx_length - handled, &frame_length);
+    if (result != MODBUS_FRAME_COMPLETE) {
+      break;
+    }
+    if (tcp_write(tpcb, tx, Modbus_handle(&modbus_server.rx[handled], frame_length, tx), TCP_WRITE_FLAG_COPY) != ERR_OK) {
+      /* the client does not read its responses */
+      result = MODBUS_FRAME_INVALID;
+      break;
+    }
+    handled += frame_length;
+  }
+  if (result == MODBUS_FRAME_INVALID) {
+    /* without a valid length the following frames cannot be found anymore */
+    modbus_server.pcb = NULL;
+    tcp_abort(tpcb);
+    return ERR_ABRT;
+  }
+  modbus_server.rx_length -= handled;
+  memmove(modbus_server.rx, &modbus_server.rx[handled], modbus_server.rx_length);
+  return ERR_OK;
+}
+
+static void modbus_server_error(void *arg, err_t err) {
+  LWIP_UNUSED_ARG(arg);
+  LWIP_UNUSED_ARG(err);
+
+  /* the pcb is already freed by lwIP */
+  modbus_server.pcb = NULL;
+}
+
+static err_t modbus_server_poll(void *arg, struct tcp_pcb *tpcb) {
+  LWIP_UNUSED_ARG(arg);
+
+  if (++modbus_server.idle_polls >= MODBUS_SERVER_IDLE_POLLS) {
+    modbus_server_connection_close(tpcb);
+  }
+  return ERR_OK;
+}
+
+static void modbus_server_connection_close(struct tcp_pcb *tpcb) {
+  tcp_recv(tpcb, NULL);
+  tcp_err(tpcb, NULL);
+  tcp_poll(tpcb, NULL, 0);
+  modbus_server.pcb = NULL;
+  modbus_server.rx_length = 0;
+  tcp_close(tpcb);
+}
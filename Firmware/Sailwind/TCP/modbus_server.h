@@ -0,0 +1,19 @@
+/**
+ * \file modbus_server.h
+ * @date 17 Oct 2026
+ * @brief tcp listener of Modbus TCP
+ */
+
+#ifndef TCP_MODBUS_SERVER_H_
+#define TCP_MODBUS_SERVER_H_
+
+#include "lwip/ip_addr.h"
+
+/**
+ * @brief  Starts listening for one Modbus TCP client on MODBUS_SERVER_PORT
+ * @param  ip_addr: address the REST listener is bound to
+ * @retval None
+ */
+void modbus_server_init(const ip_addr_t *ip_addr);
+
+#endif /* TCP_MODBUS_SERVER_H_ */
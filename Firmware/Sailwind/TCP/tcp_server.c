@@ -6,6 +6,7 @@
 
 #include "tcp.h"
 #include <string.h>
+#include <ctype.h>
 #include "lwip.h"
 #include "cJSON.h"
 #include "REST.h"
@@ -13,23 +14,59 @@
 #include "FRAM.h"
 #include "FRAM_memory_mapping.h"
 #include "boolean.h"
+#include "tcp_server.h"
+#include "binary_server.h"
+#include "modbus_server.h"
+#include "WebSocket.h"
 
 #define REST_API_PORT 2375
 
+#define TCP_SERVER_POLL_INTERVAL  2U    /* in TCP coarse timer ticks (500 ms) */
+#define TCP_SERVER_IDLE_POLLS     20U   /* close a keep-alive connection after 10 s without request */
+#define TCP_SERVER_REQUEST_SIZE   512U  /* request line, header and body of one request */
+#define TCP_SERVER_NUM_OF_SLOTS   4U    /* simultaneous REST connections, less than MEMP_NUM_TCP_PCB */
+#define TCP_SERVER_STREAM_CHECK_MS      100U    /* how often an on change stream compares the data */
+#define TCP_SERVER_STREAM_HEARTBEAT_MS  10000U  /* an on change stream repeats unchanged data after this time */
+
+#define HTTP_END_OF_HEADER        "\r\n\r\n"
+#define HTTP_CONTENT_LENGTH       "Content-Length:"
+#define HTTP_CONNECTION           "Connection:"
+#define HTTP_VERSION_1_0          "HTTP/1.0"
+#define HTTP_RESPONSE_TOO_LARGE   "HTTP/1.1 413 Payload Too Large\r\nContent-Length: 0\r\nConnection: close\r\n\r\n"
+
 enum tcp_server_states {
   ES_NONE = 0,
   ES_ACCEPTED,
   ES_RECEIVED,
-  ES_CLOSING
+  ES_STREAMING,      /* the connection sends server-sent events, requests are ignored */
+  ES_WEBSOCKET,      /* the connection sends WebSocket events and receives WebSocket commands */
+  ES_CLOSING,
+  ES_CLOSED          /* pcb is closed, the slot is kept until the response is acknowledged */
+};
+
+/* parse state of the first request in tcp_server_struct::p */
+struct tcp_server_request {
+  u16_t scanned;          /* offset from which the end of the header is searched next */
+  u16_t header_length;    /* 0 while the end of the header is not received */
+  u32_t content_length;
+  boolean_t keep_alive;
 };
 
 struct tcp_server_struct {
-  uint8_t state;
-  uint8_t retries;
+  uint8_t state;     /* ES_NONE: slot is free */
+  uint8_t idle_polls;
   struct tcp_pcb *pcb;
-  struct pbuf *p;
+  struct pbuf *p;    /* received data that is not handled yet */
+  u16_t unacked;     /* bytes of response that are not acknowledged yet */
+  struct tcp_server_request request;
+  REST_stream_t stream;
+  u32_t stream_check_ms;   /* time of the last data comparison or interval event */
+  u32_t stream_event_ms;   /* time of the last event */
+  char response[REST_RESPONSE_SIZE];  /* sent without copy, so it has to stay until the ACK */
 };
 
+static struct tcp_server_struct tcp_server_slots[TCP_SERVER_NUM_OF_SLOTS];
+
 /**
  * @brief  This function is the implementation of tcp_accept LwIP callback
  * @param  arg: not used
@@ -40,14 +77,75 @@ struct tcp_server_struct {
 static err_t tcp_server_accept(void *arg, struct tcp_pcb *newpcb, err_t err);
 
 /**
- * @brief  This function handles incoming tcp packets and passes them to the REST handler
- * @param  arg: not used
- * @param  newpcb: pointer on tcp_pcb connection
- * @param  err: not used
+ * @brief  This function passes every complete request of the received data to the REST handler
+ *         and writes the responses, as long as the send buffer can take a response
+ * @param  tpcb: pointer on tcp_pcb connection
+ * @param  tcp_server: pointer on the connection state
  * @retval none
  */
 static void tcp_server_handle(struct tcp_pcb *tpcb,
-                              struct tcp_server_struct *es);
+                              struct tcp_server_struct *tcp_server);
+
+/**
+ * @brief  This function answers every complete WebSocket frame of the received data, a close
+ *         frame or an invalid frame closes the connection
+ * @param  tpcb: pointer on tcp_pcb connection
+ * @param  tcp_server: pointer on the connection state
+ * @retval none
+ */
+static void tcp_server_websocket(struct tcp_pcb *tpcb,
+                                 struct tcp_server_struct *tcp_server);
+
+/**
+ * @brief  This function continues parsing the first request of the received pbuf chain in place
+ * @param  tcp_server: pointer on the connection state
+ * @retval length of the request (header and Content-Length body), 0 if it is not complete,
+ *         TCP_SERVER_REQUEST_SIZE or more if it does not fit into the request buffer
+ */
+static u32_t tcp_server_parse_request(struct tcp_server_struct *tcp_server);
+
+/**
+ * @brief  This function reads Content-Length and the connection persistence from a complete header
+ * @param  p: pointer on the received pbuf chain
+ * @param  end_of_header: offset of the empty line
+ * @param  request: pointer on the parse state
+ * @retval None
+ */
+static void tcp_server_parse_header(const struct pbuf *p, u16_t end_of_header,
+                                    struct tcp_server_request *request);
+
+/**
+ * @brief  This function compares received data with a string, ignoring the case
+ * @param  p: pointer on the received pbuf chain
+ * @param  offset: offset of the data in the chain
+ * @param  s: null terminated string
+ * @retval 0 if equal
+ */
+static u8_t tcp_server_pbuf_casecmp(const struct pbuf *p, u16_t offset, const char *s);
+
+/**
+ * @brief  This function takes a free connection slot
+ * @param  None
+ * @retval pointer on the slot, NULL if all slots are in use
+ */
+static struct tcp_server_struct* tcp_server_alloc_slot(void);
+
+/**
+ * @brief  This function gives a slot back to the pool
+ * @param  tpcb: pointer on the tcp_pcb connection
+ * @param  tcp_server: pointer on the slot
+ * @retval None
+ */
+static void tcp_server_free_slot(struct tcp_pcb *tpcb,
+                                 struct tcp_server_struct *tcp_server);
+
+/**
+ * @brief  This function sends the next event of a streaming connection, when it is due and the
+ *         previous event is acknowledged
+ * @param  tcp_server: pointer on the slot
+ * @retval None
+ */
+static void tcp_server_stream(struct tcp_server_struct *tcp_server);
 
 /**
  * @brief  This function is the implementation for tcp_recv LwIP callback
@@ -85,14 +183,6 @@ static err_t tcp_server_poll(void *arg, struct tcp_pcb *tpcb);
  */
 static err_t tcp_server_sent(void *arg, struct tcp_pcb *tpcb, u16_t len);
 
-/**
- * @brief  This function is used to send data for tcp connection
- * @param  tpcb: pointer on the tcp_pcb connection
- * @param  es: pointer on echo_state structure
- * @retval None
- */
-static void tcp_server_send(struct tcp_pcb *tpcb, struct tcp_server_struct *es);
-
 /**
  * @brief  This functions closes the tcp connection
  * @param  tcp_pcb: pointer on the tcp connection
@@ -144,6 +234,7 @@ void tcp_server_init(void) {
   }
 
   err = tcp_bind(tpcb, &myIPADDR, 2375);
+  memset(tcp_server_slots, 0, sizeof(tcp_server_slots));
 
   if (err == ERR_OK) {
     /* 3. start tcp listening for _pcb */
@@ -152,6 +243,12 @@ void tcp_server_init(void) {
 
     /* 4. initialize LwIP tcp_accept callback function */
     tcp_accept(tpcb, tcp_server_accept);
+
+    /* 5. binary protocol on the same address */
+    binary_server_init(&myIPADDR);
+
+    /* 6. Modbus TCP on the same address */
+    modbus_server_init(&myIPADDR);
   } else {
     /* deallocate the pcb */
     memp_free(MEMP_TCP_PCB, tpcb);
@@ -163,42 +260,87 @@ static err_t tcp_server_accept(void *arg, struct tcp_pcb *newpcb, err_t err) {
   struct tcp_server_struct *tcp_server;
 
   LWIP_UNUSED_ARG(arg);
-  LWIP_UNUSED_ARG(err);
+
+  /* lwIP could not allocate a pcb for the connection */
+  if ((err != ERR_OK) || (newpcb == NULL)) {
+    return ERR_VAL;
+  }
 
   /* set priority for the newly accepted tcp connection newpcb */
   tcp_setprio(newpcb, TCP_PRIO_MIN);
 
-  /* allocate structure es to maintain tcp connection information */
-  tcp_server = (struct tcp_server_struct*) mem_malloc(
-      sizeof(struct tcp_server_struct));
+  /* take a slot to maintain tcp connection information */
+  tcp_server = tcp_server_alloc_slot();
   if (tcp_server != NULL) {
     tcp_server->state = ES_ACCEPTED;
     tcp_server->pcb = newpcb;
-    tcp_server->retries = 0;
+    tcp_server->idle_polls = 0;
     tcp_server->p = NULL;
+    tcp_server->unacked = 0;
+    memset(&tcp_server->request, 0, sizeof(tcp_server->request));
+    tcp_server->stream.is_requested = False;
 
     /* pass newly allocated server structure as argument to newpcb */
     tcp_arg(newpcb, tcp_server);
 
-    /* initialize lwip tcp_recv callback function for newpcb  */
+    /* initialize lwip tcp_recv and tcp_sent callback functions for newpcb  */
     tcp_recv(newpcb, tcp_server_recv);
+    tcp_sent(newpcb, tcp_server_sent);
 
     /* initialize lwip tcp_err callback function for newpcb  */
     tcp_err(newpcb, tcp_server_error);
 
     /* initialize lwip tcp_poll callback function for newpcb */
-    tcp_poll(newpcb, tcp_server_poll, 0);
+    tcp_poll(newpcb, tcp_server_poll, TCP_SERVER_POLL_INTERVAL);
 
     ret_err = ERR_OK;
   } else {
-    /*  close tcp connection */
-    tcp_server_connection_close(newpcb, tcp_server);
-    /* return memory error */
-    ret_err = ERR_MEM;
+    /* all slots in use, refuse the connection with a reset */
+    tcp_abort(newpcb);
+    ret_err = ERR_ABRT;
   }
   return ret_err;
 }
 
+void tcp_server_update(void) {
+  for (uint8_t i = 0; i < TCP_SERVER_NUM_OF_SLOTS; i++) {
+    if ((tcp_server_slots[i].state == ES_STREAMING) || (tcp_server_slots[i].state == ES_WEBSOCKET)) {
+      tcp_server_stream(&tcp_server_slots[i]);
+    }
+  }
+}
+
+uint8_t tcp_server_get_num_of_free_slots(void) {
+  uint8_t num_of_free_slots = 0;
+
+  for (uint8_t i = 0; i < TCP_SERVER_NUM_OF_SLOTS; i++) {
+    if (tcp_server_slots[i].state == ES_NONE) {
+      num_of_free_slots++;
+    }
+  }
+  return num_of_free_slots;
+}
+
+static struct tcp_server_struct* tcp_server_alloc_slot(void) {
+  for (uint8_t i = 0; i < TCP_SERVER_NUM_OF_SLOTS; i++) {
+    if (tcp_server_slots[i].state == ES_NONE) {
+      return &tcp_server_slots[i];
+    }
+  }
+  return NULL;
+}
+
+static void tcp_server_free_slot(struct tcp_pcb *tpcb,
+                                 struct tcp_server_struct *tcp_server) {
+  if (tpcb != NULL) {
+    tcp_arg(tpcb, NULL);
+    tcp_sent(tpcb, NULL);
+    tcp_err(tpcb, NULL);
+  }
+  tcp_server->pcb = NULL;
+  tcp_server->state = ES_NONE;
+}
+
 static err_t tcp_server_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p,
                              err_t err) {
   struct tcp_server_struct *tcp_server;
@@ -210,68 +352,48 @@ static err_t tcp_server_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p,
 
   /* if empty tcp frame from client => close connection */
   if (p == NULL) {
-    /* remote host closed connection */
+    /* remote host closed connection, an incomplete WebSocket frame cannot be completed anymore */
+    boolean_t is_websocket = (tcp_server->state == ES_WEBSOCKET) ? True : False;
     tcp_server->state = ES_CLOSING;
-    if (tcp_server->p == NULL) {
+    if ((tcp_server->p == NULL) || (is_websocket == True)) {
       /* we're done sending, close connection */
       tcp_server_connection_close(tpcb, tcp_server);
     } else {
-      /* we're not done yet */
-      /* acknowledge received packet */
-      tcp_sent(tpcb, tcp_server_sent);
-
-      /* send remaining data*/
-      tcp_server_send(tpcb, tcp_server);
+      /* we're not done yet, answer the remaining requests */
+      tcp_server_handle(tpcb, tcp_server);
     }
     ret_err = ERR_OK;
   }
   /* else : a non empty frame was received from client but for some reason err != ERR_OK */
   else if (err != ERR_OK) {
     /* free received pbuf*/
-    if (p != NULL) {
-      tcp_server->p = NULL;
-      pbuf_free(p);
-    }
+    pbuf_free(p);
     ret_err = err;
-  } else if (tcp_server->state == ES_ACCEPTED) {
-    /* first data chunk in p->payload */
+  } else if (tcp_server->state == ES_ACCEPTED || tcp_server->state == ES_RECEIVED) {
     tcp_server->state = ES_RECEIVED;
 
-    /* store reference to incoming pbuf (chain) */
-    tcp_server->p = p;
-
-    /* initialize LwIP tcp_sent callback function */
-    tcp_sent(tpcb, tcp_server_sent);
+    /* append to the data that is not handled yet */
+    if (tcp_server->p == NULL) {
+      tcp_server->p = p;
+    } else {
+      pbuf_cat(tcp_server->p, p);
+    }
 
-    /* handle the received data */
+    /* handle the received requests */
     tcp_server_handle(tpcb, tcp_server);
 
     ret_err = ERR_OK;
-  } else if (tcp_server->state == ES_RECEIVED) {
-    /* more data received from client and previous data has been already sent*/
+  } else if (tcp_server->state == ES_WEBSOCKET) {
     if (tcp_server->p == NULL) {
       tcp_server->p = p;
-
-      /* handle the received data */
-      tcp_server_handle(tpcb, tcp_server);
     } else {
-      struct pbuf *ptr;
-
-      /* chain pbufs to the end of what we recv'ed previously  */
-      ptr = tcp_server->p;
-      pbuf_chain(ptr, p);
+      pbuf_cat(tcp_server->p, p);
     }
-    ret_err = ERR_OK;
-  } else if (tcp_server->state == ES_CLOSING) {
-    /* odd case, remote side closing twice, trash data */
-    tcp_recved(tpcb, p->tot_len);
-    tcp_server->p = NULL;
-    pbuf_free(p);
+    tcp_server_websocket(tpcb, tcp_server);
     ret_err = ERR_OK;
   } else {
-    /* unknown es->state, trash data  */
+    /* streaming, remote side closing twice or unknown state, trash data */
     tcp_recved(tpcb, p->tot_len);
-    tcp_server->p = NULL;
     pbuf_free(p);
     ret_err = ERR_OK;
   }
@@ -280,16 +402,222 @@ static err_t tcp_server_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p,
 
 static void tcp_server_handle(struct tcp_pcb *tpcb,
                               struct tcp_server_struct *tcp_server) {
-  char buf[300];
+  static char request[TCP_SERVER_REQUEST_SIZE];
+  u32_t request_length;
+  u16_t response_length;
+  boolean_t keep_alive;
+
+  /* pipelined requests wait in tcp_server->p until the previous response is acknowledged */
+  while ((tcp_server->p != NULL) && (tcp_server->unacked == 0)
+      && (tcp_sndbuf(tpcb) >= REST_RESPONSE_SIZE)) {
+    request_length = tcp_server_parse_request(tcp_server);
+    if (request_length == 0) {
+      /* wait for the next segment */
+      break;
+    }
+    if (request_length >= TCP_SERVER_REQUEST_SIZE) {
+      /* the request cannot be buffered, the following data cannot be framed either */
+      strcpy(tcp_server->response, HTTP_RESPONSE_TOO_LARGE);
+      keep_alive = False;
+    } else {
+      pbuf_copy_partial(tcp_server->p, request, (u16_t) request_length, 0);
+      request[request_length] = '\0';
+      keep_alive = tcp_server->request.keep_alive;
+
+      REST_request_handler(request, tcp_server->response, &tcp_server->stream);
+
+      tcp_server->p = pbuf_free_header(tcp_server->p, (u16_t) request_length);
+      tcp_recved(tpcb, (u16_t) request_length);
+      memset(&tcp_server->request, 0, sizeof(tcp_server->request));
+      tcp_server->idle_polls = 0;
+    }
+    if (tcp_server->stream.is_requested) {
+      /* the response is the stream header, the first event follows with the next update */
+      tcp_server->state = (tcp_server->stream.is_websocket == True) ? ES_WEBSOCKET : ES_STREAMING;
+      tcp_server->stream_check_ms = sys_now() - TCP_SERVER_STREAM_HEARTBEAT_MS;
+      tcp_server->stream_event_ms = tcp_server->stream_check_ms;
+      if ((tcp_server->state == ES_STREAMING) && (tcp_server->p != NULL)) {
+        tcp_recved(tpcb, tcp_server->p->tot_len);
+        pbuf_free(tcp_server->p);
+        tcp_server->p = NULL;
+      }
+    }
+
+    /* the response is referenced by the send queue, not copied */
+    response_length = strlen(tcp_server->response);
+    if (tcp_write(tpcb, tcp_server->response, response_length, 0) != ERR_OK) {
+      tcp_server_connection_close(tpcb, tcp_server);
+      return;
+    }
+    tcp_server->unacked = response_length;
+    if (keep_alive == False) {
+      tcp_server_connection_close(tpcb, tcp_server);
+      return;
+    }
+    if (tcp_server->state == ES_WEBSOCKET) {
+      /* frames sent right behind the handshake */
+      tcp_server_websocket(tpcb, tcp_server);
+      return;
+    }
+  }
+  /* the client closed, an incomplete request cannot be completed anymore */
+  if ((tcp_server->state == ES_CLOSING)
+      && ((tcp_server->p == NULL) || (tcp_server_parse_request(tcp_server) == 0))) {
+    tcp_server_connection_close(tpcb, tcp_server);
+  }
+}
+
+static void tcp_server_websocket(struct tcp_pcb *tpcb,
+                                 struct tcp_server_struct *tcp_server) {
+  uint8_t frame_buffer[WEBSOCKET_MAX_CLIENT_FRAME];
+  uint8_t reply[WEBSOCKET_MAX_HEADER_SIZE + WEBSOCKET_MAX_PAYLOAD];
+  uint8_t close_status[2] = { WEBSOCKET_CLOSE_PROTOCOL_ERROR >> 8, WEBSOCKET_CLOSE_PROTOCOL_ERROR & 0xFFU };
+  WebSocket_frame_t frame;
+  size_t consumed = 0U;
+  size_t reply_length;
+  int8_t result;
+
+  while (tcp_server->p != NULL) {
+    result = WebSocket_decode(frame_buffer,
+                              pbuf_copy_partial(tcp_server->p, frame_buffer, sizeof(frame_buffer), 0),
+                              &frame, &consumed);
+    if (result == WEBSOCKET_FRAME_INCOMPLETE) {
+      /* wait for the next segment */
+      break;
+    }
+    reply_length = 0U;
+    if (result == WEBSOCKET_FRAME_INVALID) {
+      reply_length = WebSocket_encode(reply, sizeof(reply), WEBSOCKET_OPCODE_CLOSE, close_status, sizeof(close_status));
+    } else if (frame.opcode == WEBSOCKET_OPCODE_CLOSE) {
+      /* echo the status code of the client */
+      reply_length = WebSocket_encode(reply, sizeof(reply), WEBSOCKET_OPCODE_CLOSE, frame.payload, frame.length);
+    } else if (frame.opcode == WEBSOCKET_OPCODE_TEXT) {
+      reply_length = REST_websocket_command(frame.payload, (char*) reply, sizeof(reply));
+    } else if (frame.opcode == WEBSOCKET_OPCODE_PING) {
+      reply_length = WebSocket_encode(reply, sizeof(reply), WEBSOCKET_OPCODE_PONG, frame.payload, frame.length);
+    }
+    /* binary frames and pongs are ignored */
+    if ((reply_length != 0U) && (tcp_write(tpcb, reply, (u16_t) reply_length, TCP_WRITE_FLAG_COPY) == ERR_OK)) {
+      /* the event buffer is only reused when the replies in front of it are acknowledged as well */
+      tcp_server->unacked += (u16_t) reply_length;
+    }
+    if ((result == WEBSOCKET_FRAME_INVALID) || (frame.opcode == WEBSOCKET_OPCODE_CLOSE)) {
+      tcp_output(tpcb);
+      tcp_server_connection_close(tpcb, tcp_server);
+      return;
+    }
+    tcp_server->p = pbuf_free_header(tcp_server->p, (u16_t) consumed);
+    tcp_recved(tpcb, (u16_t) consumed);
+  }
+  tcp_output(tpcb);
+}
 
-  REST_request_handler((char*) tcp_server->p->payload, buf);
+static u32_t tcp_server_parse_request(struct tcp_server_struct *tcp_server) {
+  struct pbuf *p = tcp_server->p;
+  struct tcp_server_request *request = &tcp_server->request;
+  u16_t end_of_header;
+  u32_t request_length;
+
+  if (request->header_length == 0) {
+    /* continue where the last search stopped, the end of the header may span two segments */
+    end_of_header = pbuf_memfind(p, HTTP_END_OF_HEADER, strlen(HTTP_END_OF_HEADER), request->scanned);
+    if (end_of_header == 0xFFFF) {
+      if (p->tot_len >= strlen(HTTP_END_OF_HEADER)) {
+        request->scanned = p->tot_len - (strlen(HTTP_END_OF_HEADER) - 1U);
+      }
+      return (p->tot_len >= TCP_SERVER_REQUEST_SIZE) ? p->tot_len : 0;
+    }
+    request->header_length = end_of_header + strlen(HTTP_END_OF_HEADER);
+    tcp_server_parse_header(p, end_of_header, request);
+  }
+  request_length = request->header_length + request->content_length;
+  if ((request_length < TCP_SERVER_REQUEST_SIZE) && (p->tot_len < request_length)) {
+    /* body not complete */
+    return 0;
+  }
+  return request_length;
+}
 
-  tcp_server->p->payload = (void*) buf;
-  tcp_server->p->tot_len = (tcp_server->p->tot_len - tcp_server->p->len)
-      + strlen(buf);
-  tcp_server->p->len = strlen(buf);
+static void tcp_server_parse_header(const struct pbuf *p, u16_t end_of_header,
+                                    struct tcp_server_request *request) {
+  u16_t line = 0;
+  u16_t line_end;
+  u16_t value;
+
+  request->keep_alive = True;
+  request->content_length = 0;
+  while (line < end_of_header) {
+    line_end = pbuf_memfind(p, "\r\n", strlen("\r\n"), line);
+    if (line == 0) {
+      /* request line, HTTP/1.0 closes the connection unless the client asks for keep-alive */
+      if ((line_end >= strlen(HTTP_VERSION_1_0))
+          && (pbuf_memcmp(p, line_end - strlen(HTTP_VERSION_1_0), HTTP_VERSION_1_0, strlen(HTTP_VERSION_1_0)) == 0)) {
+        request->keep_alive = False;
+      }
+    } else if (tcp_server_pbuf_casecmp(p, line, HTTP_CONTENT_LENGTH) == 0) {
+      for (value = line + strlen(HTTP_CONTENT_LENGTH); value < line_end; value++) {
+        u8_t digit = pbuf_get_at(p, value);
+        if ((digit >= '0') && (digit <= '9') && (request->content_length < TCP_SERVER_REQUEST_SIZE)) {
+          request->content_length = request->content_length * 10U + (digit - '0');
+        }
+      }
+    } else if (tcp_server_pbuf_casecmp(p, line, HTTP_CONNECTION) == 0) {
+      for (value = line + strlen(HTTP_CONNECTION); value < line_end; value++) {
+        if (tcp_server_pbuf_casecmp(p, value, "close") == 0) {
+          request->keep_alive = False;
+        } else if (tcp_server_pbuf_casecmp(p, value, "keep-alive") == 0) {
+          request->keep_alive = True;
+        }
+      }
+    }
+    line = line_end + strlen("\r\n");
+  }
+}
 
-  tcp_server_send(tpcb, tcp_server);
+static u8_t tcp_server_pbuf_casecmp(const struct pbuf *p, u16_t offset, const char *s) {
+  for (u16_t i = 0; s[i] != '\0'; i++) {
+    if (tolower(pbuf_get_at(p, offset + i)) != tolower((u8_t) s[i])) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static void tcp_server_stream(struct tcp_server_struct *tcp_server) {
+  static char event[REST_RESPONSE_SIZE];
+  u32_t now = sys_now();
+  u32_t period = tcp_server->stream.interval_ms;
+  u16_t event_length;
+
+  if (period == 0) {
+    period = TCP_SERVER_STREAM_CHECK_MS;
+  }
+  /* one event in flight, the next one waits for the ACK */
+  if ((tcp_server->unacked != 0) || (tcp_sndbuf(tcp_server->pcb) < REST_RESPONSE_SIZE)
+      || (now - tcp_server->stream_check_ms < period)) {
+    return;
+  }
+  tcp_server->stream_check_ms = now;
+
+  event_length = (tcp_server->stream.is_websocket == True) ? REST_create_websocket_event(event, sizeof(event))
+                                                          : REST_create_stream_event(event, sizeof(event));
+  if (event_length == 0) {
+    return;
+  }
+  /* the previous event is still in the response buffer */
+  if ((tcp_server->stream.interval_ms == 0)
+      && (now - tcp_server->stream_event_ms < TCP_SERVER_STREAM_HEARTBEAT_MS)
+      && (memcmp(event, tcp_server->response, event_length + 1U) == 0)) {
+    return;
+  }
+  memcpy(tcp_server->response, event, event_length + 1U);
+  tcp_server->stream_event_ms = now;
+  if (tcp_write(tcp_server->pcb, tcp_server->response, event_length, 0) != ERR_OK) {
+    tcp_server_connection_close(tcp_server->pcb, tcp_server);
+    return;
+  }
+  tcp_server->unacked = event_length;
+  tcp_output(tcp_server->pcb);
 }
 
 static void tcp_server_error(void *arg, err_t err) {
@@ -299,8 +627,12 @@ static void tcp_server_error(void *arg, err_t err) {
 
   tcp_server = (struct tcp_server_struct*) arg;
   if (tcp_server != NULL) {
-    /*  free es structure */
-    mem_free(tcp_server);
+    /* the pcb is already freed, give back the slot and the data that is not handled yet */
+    if (tcp_server->p != NULL) {
+      pbuf_free(tcp_server->p);
+      tcp_server->p = NULL;
+    }
+    tcp_server_free_slot(NULL, tcp_server);
   }
 }
 
@@ -310,16 +642,22 @@ static err_t tcp_server_poll(void *arg, struct tcp_pcb *tpcb) {
 
   tcp_server = (struct tcp_server_struct*) arg;
   if (tcp_server != NULL) {
-    if (tcp_server->p != NULL) {
-      tcp_sent(tpcb, tcp_server_sent);
-      /* there is a remaining pbuf (chain) , try to send data */
-      tcp_server_send(tpcb, tcp_server);
-    } else {
-      /* no remaining pbuf (chain)  */
-      if (tcp_server->state == ES_CLOSING) {
-        /*  close tcp connection */
+    if ((tcp_server->p != NULL) && (tcp_server->state != ES_WEBSOCKET)) {
+      /* there are requests left, try to answer them, a completed request resets the idle polls */
+      tcp_server->idle_polls++;
+      tcp_server_handle(tpcb, tcp_server);
+      if (((tcp_server->state == ES_RECEIVED) || (tcp_server->state == ES_CLOSING))
+          && (tcp_server->idle_polls >= TCP_SERVER_IDLE_POLLS)) {
+        /* incomplete request of an idle client or responses the client does not take */
         tcp_server_connection_close(tpcb, tcp_server);
       }
+    } else if (tcp_server->state == ES_CLOSING) {
+      /*  close tcp connection */
+      tcp_server_connection_close(tpcb, tcp_server);
+    } else if ((tcp_server->state != ES_STREAMING) && (tcp_server->state != ES_WEBSOCKET)
+        && (++tcp_server->idle_polls >= TCP_SERVER_IDLE_POLLS)) {
+      /* idle keep-alive connection, free the pcb for other clients */
+      tcp_server_connection_close(tpcb, tcp_server);
     }
     ret_err = ERR_OK;
   } else {
@@ -333,15 +671,17 @@ static err_t tcp_server_poll(void *arg, struct tcp_pcb *tpcb) {
 static err_t tcp_server_sent(void *arg, struct tcp_pcb *tpcb, u16_t len) {
   struct tcp_server_struct *tcp_server;
 
-  LWIP_UNUSED_ARG(len);
-
   tcp_server = (struct tcp_server_struct*) arg;
-  tcp_server->retries = 0;
+  tcp_server->unacked = (len < tcp_server->unacked) ? tcp_server->unacked - len : 0;
 
-  if (tcp_server->p != NULL) {
-    /* still got pbufs to send */
-    tcp_sent(tpcb, tcp_server_sent);
-    tcp_server_send(tpcb, tcp_server);
+  if (tcp_server->state == ES_CLOSED) {
+    /* the last response of a closed connection is acknowledged */
+    if (tcp_server->unacked == 0) {
+      tcp_server_free_slot(tpcb, tcp_server);
+    }
+  } else if ((tcp_server->p != NULL) && (tcp_server->state != ES_WEBSOCKET)) {
+    /* the send buffer has space again, answer the waiting requests */
+    tcp_server_handle(tpcb, tcp_server);
   } else {
     /* if no more data to send and client closed connection*/
     if (tcp_server->state == ES_CLOSING)
@@ -350,63 +690,24 @@ static err_t tcp_server_sent(void *arg, struct tcp_pcb *tpcb, u16_t len) {
   return ERR_OK;
 }
 
-static void tcp_server_send(struct tcp_pcb *tpcb,
-                            struct tcp_server_struct *tcp_server) {
-  struct pbuf *ptr;
-  err_t wr_err = ERR_OK;
-
-  while ((wr_err == ERR_OK) && (tcp_server->p != NULL)
-      && (tcp_server->p->len <= tcp_sndbuf(tpcb))) {
-
-    /* get pointer on pbuf from es structure */
-    ptr = tcp_server->p;
-
-    /* enqueue data for transmission */
-    wr_err = tcp_write(tpcb, ptr->payload, ptr->len, 1);
-
-    if (wr_err == ERR_OK) {
-      u16_t plen;
-      u8_t freed;
-
-      plen = ptr->len;
-
-      /* continue with next pbuf in chain (if any) */
-      tcp_server->p = ptr->next;
-
-      if (tcp_server->p != NULL) {
-        /* increment reference count for es->p */
-        pbuf_ref(tcp_server->p);
-      }
-
-      /* chop first pbuf from chain */
-      do {
-        /* try hard to free pbuf */
-        freed = pbuf_free(ptr);
-      } while (freed == 0);
-      /* we can read more data now */
-      tcp_recved(tpcb, plen);
-    } else if (wr_err == ERR_MEM) {
-      /* we are low on memory, try later / harder, defer to poll */
-      tcp_server->p = ptr;
-    } else {
-      /* other problem ?? */
-    }
-  }
-}
-
 static void tcp_server_connection_close(struct tcp_pcb *tpcb,
                                         struct tcp_server_struct *tcp_server) {
 
-  /* remove all callbacks */
-  tcp_arg(tpcb, NULL);
-  tcp_sent(tpcb, NULL);
+  /* no more requests */
   tcp_recv(tpcb, NULL);
-  tcp_err(tpcb, NULL);
   tcp_poll(tpcb, NULL, 0);
 
-  /* delete es structure */
-  if (tcp_server != NULL) {
-    mem_free(tcp_server);
+  /* unhandled data is acknowledged, so the close is not turned into a reset */
+  if (tcp_server->p != NULL) {
+    tcp_recved(tpcb, tcp_server->p->tot_len);
+    pbuf_free(tcp_server->p);
+    tcp_server->p = NULL;
+  }
+  if (tcp_server->unacked == 0) {
+    tcp_server_free_slot(tpcb, tcp_server);
+  } else {
+    /* the pcb still sends the response out of the slot, it is freed by tcp_server_sent or tcp_server_error */
+    tcp_server->state = ES_CLOSED;
   }
 
   /* close tcp connection */
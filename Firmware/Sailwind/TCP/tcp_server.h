@@ -8,6 +8,22 @@
 #ifndef TCP_TCP_SERVER_H_
 #define TCP_TCP_SERVER_H_
 
+#include <stdint.h>
+
 void tcp_server_init(void);
 
+/**
+ * @brief  Sends the due events of the streaming connections, to be called in the main loop
+ * @param  None
+ * @retval None
+ */
+void tcp_server_update(void);
+
+/**
+ * @brief  Counts the connection slots that can take a new REST connection
+ * @param  None
+ * @retval number of free slots
+ */
+uint8_t tcp_server_get_num_of_free_slots(void);
+
 #endif /* TCP_TCP_SERVER_H_ */
@@ -0,0 +1,88 @@
+/**
+ * \file Telemetry.c
+ * @date 17 Oct 2026
+ * @brief Snapshot of the measured values and states, refreshed once per control cycle
+ */
+#include <string.h>
+#include "Telemetry.h"
+#include "IO.h"
+
+/* private global variables -----------------------------------------------*/
+static Linear_Guide_t *Telemetry_linear_guide = { 0 };
+static IO_analogSensor_t *Telemetry_current_sensor = { 0 };
+static IO_analogSensor_t *Telemetry_distance_sensor = { 0 };
+static Telemetry_snapshot_t Telemetry_snapshot;
+static volatile uint32_t Telemetry_sequence = 0U;
+
+/* API function definitions -----------------------------------------------*/
+
+void Telemetry_init(void) {
+  Telemetry_linear_guide = LG_get_Linear_Guide();
+  Telemetry_current_sensor = IO_get_current_sensor();
+  Telemetry_distance_sensor = IO_get_distance_sensor();
+  memset(&Telemetry_snapshot, 0, sizeof(Telemetry_snapshot));
+  Telemetry_sequence = 0U;
+}
+
+void Telemetry_update(void) {
+  Localization_t *loc_ptr = &Telemetry_linear_guide->localization;
+
+  /* the distance sensor is only acquired by the control loop while localized */
+  if (loc_ptr->is_localized == False) {
+    IO_Get_Measured_Value(Telemetry_distance_sensor);
+    Localization_parse_distance_sensor_value(loc_ptr, Telemetry_distance_sensor->measured_value);
+  }
+
+  /* odd sequence: readers retry until the snapshot is complete again */
+  Telemetry_sequence++;
+  __DMB();
+
+  Telemetry_snapshot.sequence = Telemetry_sequence + 1U;
+  Telemetry_snapshot.timestamp_ms = HAL_GetTick();
+  Telemetry_snapshot.error_state = Telemetry_linear_guide->error_state;
+  Telemetry_snapshot.operating_mode = Telemetry_linear_guide->operating_mode;
+  Telemetry_snapshot.sail_adjustment_mode = Telemetry_linear_guide->sail_adjustment_mode;
+  Telemetry_snapshot.is_localized = loc_ptr->is_localized;
+  Telemetry_snapshot.localization_state = loc_ptr->state;
+  Telemetry_snapshot.pulse_count = loc_ptr->pulse_count;
+  Telemetry_snapshot.end_pos_mm = loc_ptr->end_pos_mm;
+  Telemetry_snapshot.center_pos_mm = loc_ptr->center_pos_mm;
+  Telemetry_snapshot.start_pos_abs_mm = loc_ptr->start_pos_abs_mm;
+  Telemetry_snapshot.brake_path_mm = loc_ptr->brake_path_mm;
+  Telemetry_snapshot.roll_pitch_percentage =
+      Linear_Guide_get_current_roll_pitch_percentage(*Telemetry_linear_guide);
+  Telemetry_snapshot.current_pos_um = loc_ptr->current_pos_um;
+  Telemetry_snapshot.current_pos_mm = loc_ptr->current_pos_mm;
+  Telemetry_snapshot.measured_pos_mm = loc_ptr->current_measured_pos_mm;
+  Telemetry_snapshot.desired_pos_mm = loc_ptr->desired_pos_mm;
+  Telemetry_snapshot.rpm_set_point = Telemetry_linear_guide->motor.rpm_set_point;
+  Telemetry_snapshot.movement = loc_ptr->movement;
+  Telemetry_snapshot.is_front_endswitch_detected =
+      Endswitch_detected(&Telemetry_linear_guide->endswitches.front);
+  Telemetry_snapshot.is_back_endswitch_detected =
+      Endswitch_detected(&Telemetry_linear_guide->endswitches.back);
+  /* acquired by the current fault check of this cycle */
+  Telemetry_snapshot.current_mA = Telemetry_current_sensor->measured_value;
+  Telemetry_snapshot.max_rpm = Telemetry_linear_guide->motor.normal_rpm;
+  Telemetry_snapshot.max_distance_error = Telemetry_linear_guide->max_distance_fault;
+  (void) WSWD_get_latest_sample(&Telemetry_snapshot.wind_sample);
+  for (Wind_History_window_t window = Wind_History_window_short;
+      window < Wind_History_num_of_windows; window++) {
+    (void) WSWD_get_wind_statistics(window, &Telemetry_snapshot.wind_statistics[window]);
+  }
+  WSWD_get_gust(&Telemetry_snapshot.gust);
+
+  __DMB();
+  Telemetry_sequence++;
+}
+
+void Telemetry_get_snapshot(Telemetry_snapshot_t *snapshot_ptr) {
+  uint32_t sequence;
+
+  do {
+    sequence = Telemetry_sequence;
+    __DMB();
+    memcpy(snapshot_ptr, &Telemetry_snapshot, sizeof(Telemetry_snapshot_t));
+    __DMB();
+  } while (((sequence & 1U) != 0U) || (sequence != Telemetry_sequence));
+}
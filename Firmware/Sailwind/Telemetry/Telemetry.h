@@ -0,0 +1,132 @@
+/**
+ * \file Telemetry.h
+ * @date 17 Oct 2026
+ * @brief Snapshot of the measured values and states, refreshed once per control cycle
+ *
+ * Telemetry_update copies the values the control loop has just acquired into one snapshot,
+ * so REST and SSI serialize from memory instead of triggering their own sensor reads.
+ * A sequence counter is odd while the snapshot is written; readers copy the snapshot and retry
+ * until they got an even and unchanged sequence, so every copy belongs to one cycle.
+ */
+
+#ifndef TELEMETRY_TELEMETRY_H_
+#define TELEMETRY_TELEMETRY_H_
+
+#include <stdint.h>
+#include "boolean.h"
+#include "Linear_Guide.h"
+#include "WSWD.h"
+
+/* typedefs -----------------------------------------------------------*/
+
+/** @struct Telemetry_snapshot_t
+ *  @brief values of one control cycle
+ *  @var Telemetry_snapshot_t::sequence
+ *  number of the update, even for a complete snapshot
+ *  @var Telemetry_snapshot_t::timestamp_ms
+ *  HAL tick of the update
+ *  @var Telemetry_snapshot_t::error_state
+ *  error state of the linear guide
+ *  @var Telemetry_snapshot_t::operating_mode
+ *  manual or automatic
+ *  @var Telemetry_snapshot_t::sail_adjustment_mode
+ *  roll or pitch
+ *  @var Telemetry_snapshot_t::is_localized
+ *  True once the center position is set
+ *  @var Telemetry_snapshot_t::localization_state
+ *  step of the localization
+ *  @var Telemetry_snapshot_t::pulse_count
+ *  motor pulses counted from the front endswitch
+ *  @var Telemetry_snapshot_t::end_pos_mm
+ *  distance of the endswitches from the center of the range
+ *  @var Telemetry_snapshot_t::center_pos_mm
+ *  center position of the sail adjustment
+ *  @var Telemetry_snapshot_t::start_pos_abs_mm
+ *  distance sensor value at the front endswitch
+ *  @var Telemetry_snapshot_t::brake_path_mm
+ *  distance needed to stop from the current movement
+ *  @var Telemetry_snapshot_t::roll_pitch_percentage
+ *  current position in percent of the adjustment range, without sign of the adjustment mode
+ *  @var Telemetry_snapshot_t::current_pos_um
+ *  position counted by the localization in um
+ *  @var Telemetry_snapshot_t::current_pos_mm
+ *  position counted by the localization
+ *  @var Telemetry_snapshot_t::measured_pos_mm
+ *  position of the distance sensor
+ *  @var Telemetry_snapshot_t::desired_pos_mm
+ *  target position of the localization
+ *  @var Telemetry_snapshot_t::rpm_set_point
+ *  speed the motor is driven with
+ *  @var Telemetry_snapshot_t::movement
+ *  stop, backwards or forward
+ *  @var Telemetry_snapshot_t::is_front_endswitch_detected
+ *  state of the front endswitch
+ *  @var Telemetry_snapshot_t::is_back_endswitch_detected
+ *  state of the back endswitch
+ *  @var Telemetry_snapshot_t::current_mA
+ *  motor current
+ *  @var Telemetry_snapshot_t::max_rpm
+ *  normal speed of the motor setting
+ *  @var Telemetry_snapshot_t::max_distance_error
+ *  tolerated difference between counted and measured position setting
+ *  @var Telemetry_snapshot_t::wind_sample
+ *  last valid wind telegram
+ *  @var Telemetry_snapshot_t::wind_statistics
+ *  rolling statistics of every window of the wind history
+ *  @var Telemetry_snapshot_t::gust
+ *  state of the gust detection
+ */
+typedef struct {
+  uint32_t sequence;
+  uint32_t timestamp_ms;
+  LG_error_state_t error_state;
+  LG_operating_mode_t operating_mode;
+  LG_sail_adjustment_mode_t sail_adjustment_mode;
+  boolean_t is_localized;
+  Loc_state_t localization_state;
+  int32_t pulse_count;
+  uint16_t end_pos_mm;
+  int16_t center_pos_mm;
+  uint16_t start_pos_abs_mm;
+  uint16_t brake_path_mm;
+  int8_t roll_pitch_percentage;
+  int32_t current_pos_um;
+  int16_t current_pos_mm;
+  int16_t measured_pos_mm;
+  int16_t desired_pos_mm;
+  uint16_t rpm_set_point;
+  Loc_movement_t movement;
+  boolean_t is_front_endswitch_detected;
+  boolean_t is_back_endswitch_detected;
+  uint16_t current_mA;
+  uint16_t max_rpm;
+  uint8_t max_distance_error;
+  WSWD_wind_sample_t wind_sample;
+  Wind_History_statistics_t wind_statistics[Wind_History_num_of_windows];
+  Wind_History_gust_t gust;
+} Telemetry_snapshot_t;
+
+/* API function prototypes -----------------------------------------------*/
+
+/**
+ * @brief get the sensors and the linear guide the snapshot is taken from
+ * @param none
+ * @retval none
+ */
+void Telemetry_init(void);
+
+/**
+ * @brief refresh the snapshot, has to be called once per control cycle after Linear_Guide_update
+ * @param none
+ * @retval none
+ */
+void Telemetry_update(void);
+
+/**
+ * @brief copy a consistent snapshot (non blocking for the writer)
+ * @param snapshot_ptr: ptr to the destination
+ * @retval none
+ */
+void Telemetry_get_snapshot(Telemetry_snapshot_t *snapshot_ptr);
+
+#endif /* TELEMETRY_TELEMETRY_H_ */
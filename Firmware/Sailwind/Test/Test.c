@@ -7,10 +7,50 @@
 
 #include "Test.h"
 #include <stdlib.h>
+#include <string.h>
+#include <math.h>
 #include "UART.h"
+#include "Filter.h"
+#include "NMEA.h"
+#include "cJSON.h"
+#include "JSON_Writer.h"
+#include "REST.h"
+#include "Binary_Protocol.h"
+#include "Scheduler.h"
+#include "Log.h"
+#include "Motion_Planner.h"
+#include "tcp_server.h"
+#include "lwip/tcp.h"
+#include "lwip/priv/tcp_priv.h"
 
 /* defines -------------------------------------------------------------------*/
 #define TEST_ID_SIZE 5
+#define TEST_FILTER_NUM_OF_SAMPLES 48
+#define TEST_FILTER_RUNS 100
+#define TEST_NMEA_RUNS 100
+#define TEST_JSON_RUNS 100
+#define TEST_JSON_BUFFER_SIZE 600
+#define TEST_JSON_NUM_OF_WINDOWS 2
+#define TEST_PROTOCOL_RUNS 100
+#define TEST_PROTOCOL_REST_REQUEST "GET /data/batch HTTP/1.1\r\nHost: 192.168.0.123\r\n\r\n"
+#define TEST_PLANNER_MAX_CYCLES 60000     /* 60 s of control cycles per move */
+#define TEST_PLANNER_MAX_ERROR_MM 0.093F  /* one motor pulse */
+#define TEST_PLANNER_LIMIT_SLACK 1.001F   /* rounding of the float arithmetic */
+#define TEST_TCP_SERVER_PORT 2375
+#define TEST_TCP_SERVER_MAX_POLLS 40      /* twice the idle polls of the server */
+#define TEST_TCP_SERVER_PARTIAL_REQUEST "GET /data/batch HTTP/1.1\r\nHost: 192."
+
+/* typedefs -------------------------------------------------------------------*/
+/* move of the motion planner test, the target is changed once while moving */
+typedef struct {
+	const char *name;
+	float first_target_mm;
+	uint32_t retarget_cycle;
+	float second_target_mm;
+} Test_planner_move_t;
+
+/* private variables -----------------------------------------------*/
+static uint32_t Test_cycle_counter_start_value = 0;
 
 /* private function prototypes -----------------------------------------------*/
 static void Test_switch_test_ID(UART_HandleTypeDef *huart_ptr, uint16_t test_ID, Manual_Control_t *mc_ptr);
@@ -19,6 +59,23 @@ static void Test_LED(UART_HandleTypeDef *huart_ptr, Manual_Control_t *mc_ptr);
 static void Test_Button(UART_HandleTypeDef *huart_ptr, Manual_Control_t *mc_ptr);
 static void Test_Motor(UART_HandleTypeDef *huart_ptr, Manual_Control_t *mc_ptr);
 static void Test_FRAM(UART_HandleTypeDef *huart_ptr);
+static void Test_Filter_benchmark(UART_HandleTypeDef *huart_ptr);
+static void Test_Filter_benchmark_config(UART_HandleTypeDef *huart_ptr, const Filter_config_t *config_ptr, const uint16_t *samples);
+static uint16_t Test_Filter_bubble_sort_reference(uint16_t *samples, uint8_t num_of_samples, uint8_t num_of_dispersed_samples);
+static void Test_NMEA_benchmark(UART_HandleTypeDef *huart_ptr);
+static void Test_NMEA_check(UART_HandleTypeDef *huart_ptr, const char *telegram, NMEA_result_t expected_result);
+static NMEA_result_t Test_NMEA_parse_telegram(NMEA_parser_t *parser_ptr, const char *telegram, NMEA_MWV_t *mwv_ptr);
+static void Test_NMEA_offset_reference(const char *telegram, float *speed, float *direction);
+static void Test_JSON_benchmark(UART_HandleTypeDef *huart_ptr);
+static size_t Test_JSON_cJSON_reference(char *buffer);
+static size_t Test_JSON_writer(char *buffer);
+static void Test_protocol_benchmark(UART_HandleTypeDef *huart_ptr);
+static void Test_Scheduler_statistics(UART_HandleTypeDef *huart_ptr);
+static void Test_Motion_Planner(UART_HandleTypeDef *huart_ptr, Manual_Control_t *mc_ptr);
+static void Test_Motion_Planner_move(UART_HandleTypeDef *huart_ptr, const Motion_Planner_limits_t *limits_ptr, const Test_planner_move_t *move_ptr);
+static void Test_tcp_server_idle_request(UART_HandleTypeDef *huart_ptr);
+static void Test_cycle_counter_start(void);
+static uint32_t Test_cycle_counter_read(void);
 
 /* API function definitions -----------------------------------------------*/
 void Test_uart_poll(UART_HandleTypeDef *huart_ptr, char *Rx_buffer, Manual_Control_t *mc_ptr)
@@ -64,6 +121,30 @@ static void Test_switch_test_ID(UART_HandleTypeDef *huart_ptr, uint16_t test_ID,
 		case 7:
 			Test_FRAM(huart_ptr);
 			break;
+		case 8:
+			Test_Filter_benchmark(huart_ptr);
+			break;
+		case 9:
+			Test_NMEA_benchmark(huart_ptr);
+			break;
+		case 10:
+			Test_JSON_benchmark(huart_ptr);
+			break;
+		case 11:
+			UART_transmit_ln_int(huart_ptr, "REST arena high-water mark: %d", REST_get_arena_high_water_mark());
+			break;
+		case 12:
+			Test_protocol_benchmark(huart_ptr);
+			break;
+		case 13:
+			Test_Scheduler_statistics(huart_ptr);
+			break;
+		case 14:
+			Test_Motion_Planner(huart_ptr, mc_ptr);
+			break;
+		case 15:
+			Test_tcp_server_idle_request(huart_ptr);
+			break;
 		default:
 			UART_transmit_ln(huart_ptr, "no valid test ID!");
 			break;
@@ -145,13 +226,13 @@ static void Test_Motor(UART_HandleTypeDef *huart_ptr, Manual_Control_t *mc_ptr)
 	motor_ptr->normal_rpm = MOTOR_RPM_SPEED_1;
 	UART_transmit_ln(huart_ptr, "switch button to start motor move clock wise with speed 1");
 	while (!Button_state_changed(&mc_ptr->buttons.switch_mode));
-	Motor_start_moving(motor_ptr, Motor_function_cw_rotation);
+	Motor_set_velocity(motor_ptr, (int16_t) motor_ptr->normal_rpm);
 	while (IO_digitalRead(&motor_ptr->OUT3_rot_dir) != MOTOR_DIRECTION_CW);
 	UART_transmit_ln(huart_ptr, "detected clockwise rotation!");
 
 	UART_transmit_ln(huart_ptr, "switch button to change direction to counter clock wise");
 	while (!Button_state_changed(&mc_ptr->buttons.switch_mode));
-	Motor_start_moving(motor_ptr, Motor_function_ccw_rotation);
+	Motor_set_velocity(motor_ptr, -(int16_t) motor_ptr->normal_rpm);
 	while (IO_digitalRead(&motor_ptr->OUT3_rot_dir) != MOTOR_DIRECTION_CCW);
 	UART_transmit_ln(huart_ptr, "detected counter clockwise rotation!");
 
@@ -160,13 +241,13 @@ static void Test_Motor(UART_HandleTypeDef *huart_ptr, Manual_Control_t *mc_ptr)
 	for (uint16_t rpm_value=MOTOR_RPM_SPEED_1; rpm_value <= MOTOR_RPM_SPEED_2; rpm_value+=15)
 	{
 		motor_ptr->normal_rpm = rpm_value;
-		Motor_start_moving(motor_ptr, Motor_function_cw_rotation);
+		Motor_set_velocity(motor_ptr, (int16_t) motor_ptr->normal_rpm);
 		HAL_Delay(2000);
 		UART_transmit_ln_int(huart_ptr, "rpm_set_point: %d", rpm_value);
 	}
 	UART_transmit_ln(huart_ptr, "switch button to stop motor");
 	while (!Button_state_changed(&mc_ptr->buttons.switch_mode));
-	Motor_stop_moving(motor_ptr, False);
+	Motor_set_velocity(motor_ptr, 0);
 }
 
 static void Test_FRAM(UART_HandleTypeDef *huart_ptr)
@@ -204,3 +285,500 @@ static void Test_FRAM(UART_HandleTypeDef *huart_ptr)
 		UART_transmit_ln(huart_ptr, "FRAM test failed");
 	}
 }
+
+static void Test_Filter_benchmark(UART_HandleTypeDef *huart_ptr)
+{
+	const Filter_config_t configs[] = {
+			{ Filter_type_mean, TEST_FILTER_NUM_OF_SAMPLES, 0 },
+			{ Filter_type_trimmed_mean, TEST_FILTER_NUM_OF_SAMPLES, 44 },
+			{ Filter_type_trimmed_mean, TEST_FILTER_NUM_OF_SAMPLES, 8 },
+			{ Filter_type_median, TEST_FILTER_NUM_OF_SAMPLES, 0 }
+	};
+	uint16_t samples[TEST_FILTER_NUM_OF_SAMPLES];
+	uint32_t random = 12345U;
+
+	/* noisy distance sensor signal with single outliers */
+	for (uint8_t i = 0; i < TEST_FILTER_NUM_OF_SAMPLES; i++)
+	{
+		random = random * 1103515245U + 12345U;
+		samples[i] = 2000U + (random >> 16) % 40U;
+		if (i % 7 == 3)
+		{
+			samples[i] = (random >> 16) % 2 ? 4095U : 0U;
+		}
+	}
+	for (uint8_t i = 0; i < sizeof(configs) / sizeof(configs[0]); i++)
+	{
+		Test_Filter_benchmark_config(huart_ptr, &configs[i], samples);
+	}
+}
+
+static void Test_Filter_benchmark_config(UART_HandleTypeDef *huart_ptr, const Filter_config_t *config_ptr, const uint16_t *samples)
+{
+	uint16_t batch[TEST_FILTER_NUM_OF_SAMPLES];
+	uint32_t cycles_filter = 0;
+	uint32_t cycles_reference = 0;
+	uint16_t value_filter = 0;
+	uint16_t value_reference = 0;
+	uint8_t num_of_dispersed_samples = config_ptr->num_of_dispersed_samples;
+
+	if (config_ptr->type == Filter_type_median)
+	{
+		num_of_dispersed_samples = config_ptr->num_of_samples - 2 + config_ptr->num_of_samples % 2;
+	}
+	for (uint8_t run = 0; run < TEST_FILTER_RUNS; run++)
+	{
+		memcpy(batch, samples, sizeof(batch));
+		Test_cycle_counter_start();
+		value_filter = Filter_apply(config_ptr, batch);
+		cycles_filter += Test_cycle_counter_read();
+
+		memcpy(batch, samples, sizeof(batch));
+		Test_cycle_counter_start();
+		value_reference = Test_Filter_bubble_sort_reference(batch, config_ptr->num_of_samples, num_of_dispersed_samples);
+		cycles_reference += Test_cycle_counter_read();
+	}
+	UART_transmit_ln_int(huart_ptr, "filter type: %d", config_ptr->type);
+	UART_transmit_ln_int(huart_ptr, "dispersed samples: %d", config_ptr->num_of_dispersed_samples);
+	UART_transmit_ln_int(huart_ptr, "bubble sort cycles: %d", cycles_reference / TEST_FILTER_RUNS);
+	UART_transmit_ln_int(huart_ptr, "filter cycles: %d", cycles_filter / TEST_FILTER_RUNS);
+	if (value_filter != value_reference)
+	{
+		UART_transmit_ln_int(huart_ptr, "result differs from reference: %d", value_filter - value_reference);
+	}
+}
+
+/* previous implementation of IO_Get_ADC_Value (sort the whole batch, average the middle) */
+static uint16_t Test_Filter_bubble_sort_reference(uint16_t *samples, uint8_t num_of_samples, uint8_t num_of_dispersed_samples)
+{
+	uint8_t exchange = 1U;
+	uint16_t tmp = 0U;
+	uint32_t sum = 0U;
+	uint8_t cut = num_of_dispersed_samples / 2U;
+
+	while (exchange == 1U)
+	{
+		exchange = 0U;
+		for (uint8_t i = 0U; i < num_of_samples - 1U; i++)
+		{
+			if (samples[i] > samples[i + 1U])
+			{
+				tmp = samples[i];
+				samples[i] = samples[i + 1U];
+				samples[i + 1U] = tmp;
+				exchange = 1U;
+			}
+		}
+	}
+	for (uint8_t i = cut; i < num_of_samples - cut; i++)
+	{
+		sum += samples[i];
+	}
+	return (uint16_t) (sum / (num_of_samples - 2U * cut));
+}
+
+static void Test_NMEA_benchmark(UART_HandleTypeDef *huart_ptr)
+{
+	/* telegrams captured from the wind sensor, as received by the old WSWD_receive_NMEA */
+	const char *telegrams[] = {
+			"\n$WIMWV,000.0,R,000.00,M,A*10\r\n",
+			"\n$WIMWV,089.9,R,004.31,M,A*1E\r\n",
+			"\n$WIMWV,180.0,R,011.07,M,A*1E\r\n",
+			"\n$WIMWV,271.3,R,023.85,M,A*1B\r\n",
+			"\n$WIMWV,359.9,R,102.40,M,A*11\r\n"
+	};
+	const uint8_t num_of_telegrams = sizeof(telegrams) / sizeof(telegrams[0]);
+	NMEA_parser_t parser;
+	NMEA_MWV_t mwv;
+	uint32_t cycles_parser = 0;
+	uint32_t cycles_reference = 0;
+	float speed = 0.0f;
+	float direction = 0.0f;
+
+	NMEA_init(&parser);
+	for (uint8_t run = 0; run < TEST_NMEA_RUNS; run++)
+	{
+		for (uint8_t i = 0; i < num_of_telegrams; i++)
+		{
+			Test_cycle_counter_start();
+			(void) Test_NMEA_parse_telegram(&parser, telegrams[i], &mwv);
+			cycles_parser += Test_cycle_counter_read();
+
+			Test_cycle_counter_start();
+			Test_NMEA_offset_reference(telegrams[i], &speed, &direction);
+			cycles_reference += Test_cycle_counter_read();
+		}
+	}
+	UART_transmit_ln_int(huart_ptr, "offset/atof cycles per telegram: %d", cycles_reference / (TEST_NMEA_RUNS * num_of_telegrams));
+	UART_transmit_ln_int(huart_ptr, "parser cycles per telegram: %d", cycles_parser / (TEST_NMEA_RUNS * num_of_telegrams));
+
+	for (uint8_t i = 0; i < num_of_telegrams; i++)
+	{
+		Test_NMEA_offset_reference(telegrams[i], &speed, &direction);
+		if (Test_NMEA_parse_telegram(&parser, telegrams[i], &mwv) != NMEA_result_valid
+				|| mwv.speed_x100 != (uint32_t) (speed * NMEA_MWV_SPEED_SCALE + 0.5f)
+				|| mwv.angle_x10 != (uint16_t) (direction * NMEA_MWV_ANGLE_SCALE + 0.5f))
+		{
+			UART_transmit_ln_int(huart_ptr, "result differs from reference for telegram: %d", i);
+		}
+	}
+	/* variable field width, other unit, sensor status invalid, corrupted checksum, other sentence */
+	Test_NMEA_check(huart_ptr, "$WIMWV,12,R,3.5,M,A*0B\r\n", NMEA_result_valid);
+	Test_NMEA_check(huart_ptr, "$WIMWV,045.0,R,012.50,N,A*14\r\n", NMEA_result_valid);
+	Test_NMEA_check(huart_ptr, "$WIMWV,045.0,R,012.50,M,V*00\r\n", NMEA_result_invalid);
+	Test_NMEA_check(huart_ptr, "$WIMWV,045.0,R,012.50,M,A*00\r\n", NMEA_result_invalid);
+	Test_NMEA_check(huart_ptr, "$WIXDR,C,22.5,C,0*00\r\n", NMEA_result_pending);
+}
+
+static void Test_NMEA_check(UART_HandleTypeDef *huart_ptr, const char *telegram, NMEA_result_t expected_result)
+{
+	NMEA_parser_t parser;
+	NMEA_MWV_t mwv;
+
+	NMEA_init(&parser);
+	if (Test_NMEA_parse_telegram(&parser, telegram, &mwv) != expected_result)
+	{
+		UART_transmit_ln(huart_ptr, "unexpected parser result for telegram:");
+		UART_transmit_ln(huart_ptr, (char *) telegram);
+	}
+}
+
+static NMEA_result_t Test_NMEA_parse_telegram(NMEA_parser_t *parser_ptr, const char *telegram, NMEA_MWV_t *mwv_ptr)
+{
+	NMEA_result_t result = NMEA_result_pending;
+
+	for (const char *byte_ptr = telegram; *byte_ptr != '\0'; byte_ptr++)
+	{
+		NMEA_result_t byte_result = NMEA_parse_byte(parser_ptr, *byte_ptr, mwv_ptr);
+		if (byte_result != NMEA_result_pending)
+		{
+			result = byte_result;
+		}
+	}
+	return result;
+}
+
+/* previous implementation of WSWD_get_wind_infos (fixed offsets, no checksum) */
+static void Test_NMEA_offset_reference(const char *telegram, float *speed, float *direction)
+{
+	char speed_buffer[7] = { 0 };
+	char direction_buffer[6] = { 0 };
+
+	if (telegram[25] == 'A')
+	{
+		memcpy(direction_buffer, &telegram[8], 5);
+		memcpy(speed_buffer, &telegram[16], 6);
+		*direction = (float) atof(direction_buffer);
+		*speed = (float) atof(speed_buffer);
+	}
+}
+
+static void Test_JSON_benchmark(UART_HandleTypeDef *huart_ptr)
+{
+	char buffer[TEST_JSON_BUFFER_SIZE];
+	uint32_t cycles_writer = 0;
+	uint32_t cycles_reference = 0;
+	size_t length_writer = 0;
+	size_t length_reference = 0;
+
+	for (uint8_t run = 0; run < TEST_JSON_RUNS; run++)
+	{
+		Test_cycle_counter_start();
+		length_reference = Test_JSON_cJSON_reference(buffer);
+		cycles_reference += Test_cycle_counter_read();
+
+		Test_cycle_counter_start();
+		length_writer = Test_JSON_writer(buffer);
+		cycles_writer += Test_cycle_counter_read();
+	}
+	cycles_reference /= TEST_JSON_RUNS;
+	cycles_writer /= TEST_JSON_RUNS;
+	UART_transmit_ln_int(huart_ptr, "cJSON bytes: %d", length_reference);
+	UART_transmit_ln_int(huart_ptr, "cJSON cycles: %d", cycles_reference);
+	UART_transmit_ln_int(huart_ptr, "cJSON bytes per 1000 cycles: %d", length_reference * 1000U / cycles_reference);
+	UART_transmit_ln_int(huart_ptr, "writer bytes: %d", length_writer);
+	UART_transmit_ln_int(huart_ptr, "writer cycles: %d", cycles_writer);
+	UART_transmit_ln_int(huart_ptr, "writer bytes per 1000 cycles: %d", length_writer * 1000U / cycles_writer);
+	if (length_writer == 0)
+	{
+		UART_transmit_ln(huart_ptr, "writer overflow!");
+	}
+}
+
+/* previous implementation of the REST GET path (cJSON tree on the heap, formatted print) */
+static size_t Test_JSON_cJSON_reference(char *buffer)
+{
+	cJSON *response = cJSON_CreateObject();
+	cJSON *wind = cJSON_AddArrayToObject(response, "wind");
+	cJSON *members = cJSON_CreateObject();
+	cJSON *windows = NULL;
+
+	cJSON_AddNumberToObject(members, "speed", 4.31);
+	cJSON_AddNumberToObject(members, "direction", 89.9);
+	cJSON_AddItemToArray(wind, members);
+	cJSON_AddStringToObject(response, "unit", "M");
+	windows = cJSON_AddArrayToObject(response, "windows");
+	for (uint8_t i = 0; i < TEST_JSON_NUM_OF_WINDOWS; i++)
+	{
+		members = cJSON_CreateObject();
+		cJSON_AddNumberToObject(members, "duration_ms", 3000);
+		cJSON_AddNumberToObject(members, "samples", 3);
+		cJSON_AddNumberToObject(members, "mean", 4.12);
+		cJSON_AddNumberToObject(members, "max", 4.65);
+		cJSON_AddNumberToObject(members, "variance", 0.0312);
+		cJSON_AddNumberToObject(members, "direction", 91.3);
+		cJSON_AddNumberToObject(members, "steadiness", 0.987);
+		cJSON_AddItemToArray(windows, members);
+	}
+	members = cJSON_AddObjectToObject(response, "gust");
+	cJSON_AddNumberToObject(members, "active", 0);
+	cJSON_AddNumberToObject(members, "count", 2);
+	cJSON_AddNumberToObject(members, "peak", 9.85);
+	cJSON_AddNumberToObject(members, "age_ms", 41250);
+	cJSON_PrintPreallocated(response, buffer, TEST_JSON_BUFFER_SIZE, 1);
+	cJSON_Delete(response);
+	return strlen(buffer);
+}
+
+static size_t Test_JSON_writer(char *buffer)
+{
+	JSON_Writer_t writer;
+
+	JSON_Writer_init(&writer, buffer, TEST_JSON_BUFFER_SIZE);
+	JSON_Writer_begin_object(&writer, NULL);
+	JSON_Writer_begin_array(&writer, "wind");
+	JSON_Writer_begin_object(&writer, NULL);
+	JSON_Writer_add_fixed(&writer, "speed", 431, 2);
+	JSON_Writer_add_fixed(&writer, "direction", 899, 1);
+	JSON_Writer_end_object(&writer);
+	JSON_Writer_end_array(&writer);
+	JSON_Writer_add_string(&writer, "unit", "M");
+	JSON_Writer_begin_array(&writer, "windows");
+	for (uint8_t i = 0; i < TEST_JSON_NUM_OF_WINDOWS; i++)
+	{
+		JSON_Writer_begin_object(&writer, NULL);
+		JSON_Writer_add_uint(&writer, "duration_ms", 3000);
+		JSON_Writer_add_uint(&writer, "samples", 3);
+		JSON_Writer_add_fixed(&writer, "mean", 412, 2);
+		JSON_Writer_add_fixed(&writer, "max", 465, 2);
+		JSON_Writer_add_fixed(&writer, "variance", 312, 4);
+		JSON_Writer_add_fixed(&writer, "direction", 913, 1);
+		JSON_Writer_add_fixed(&writer, "steadiness", 987, 3);
+		JSON_Writer_end_object(&writer);
+	}
+	JSON_Writer_end_array(&writer);
+	JSON_Writer_begin_object(&writer, "gust");
+	JSON_Writer_add_uint(&writer, "active", 0);
+	JSON_Writer_add_uint(&writer, "count", 2);
+	JSON_Writer_add_fixed(&writer, "peak", 985, 2);
+	JSON_Writer_add_uint(&writer, "age_ms", 41250);
+	JSON_Writer_end_object(&writer);
+	JSON_Writer_end_object(&writer);
+	return JSON_Writer_finish(&writer);
+}
+
+/* server side cost of one state read: REST batch GET against a binary GET_STATE frame */
+static void Test_protocol_benchmark(UART_HandleTypeDef *huart_ptr)
+{
+	static char rest_response[REST_RESPONSE_SIZE];
+	char rest_request[] = TEST_PROTOCOL_REST_REQUEST;
+	REST_stream_t stream;
+	Binary_Protocol_frame_t binary_request = { BINARY_PROTOCOL_GET_STATE, 0, 0, { 0 } };
+	Binary_Protocol_frame_t binary_response;
+	uint8_t binary_request_frame[BINARY_PROTOCOL_MAX_FRAME_SIZE];
+	uint8_t binary_response_frame[BINARY_PROTOCOL_MAX_FRAME_SIZE];
+	size_t binary_request_length = Binary_Protocol_encode(&binary_request, binary_request_frame, sizeof(binary_request_frame));
+	size_t binary_response_length = 0;
+	size_t consumed = 0;
+	uint32_t cycles_rest = 0;
+	uint32_t cycles_binary = 0;
+
+	for (uint8_t run = 0; run < TEST_PROTOCOL_RUNS; run++)
+	{
+		Test_cycle_counter_start();
+		REST_request_handler(rest_request, rest_response, &stream);
+		cycles_rest += Test_cycle_counter_read();
+
+		Test_cycle_counter_start();
+		if (Binary_Protocol_decode(binary_request_frame, binary_request_length, &binary_request, &consumed) == BINARY_PROTOCOL_FRAME_COMPLETE)
+		{
+			Binary_Protocol_handle(&binary_request, &binary_response);
+			binary_response_length = Binary_Protocol_encode(&binary_response, binary_response_frame, sizeof(binary_response_frame));
+		}
+		cycles_binary += Test_cycle_counter_read();
+	}
+	UART_transmit_ln_int(huart_ptr, "REST request bytes: %d", strlen(TEST_PROTOCOL_REST_REQUEST));
+	UART_transmit_ln_int(huart_ptr, "REST response bytes: %d", strlen(rest_response));
+	UART_transmit_ln_int(huart_ptr, "REST cycles: %d", cycles_rest / TEST_PROTOCOL_RUNS);
+	UART_transmit_ln_int(huart_ptr, "binary request bytes: %d", binary_request_length);
+	UART_transmit_ln_int(huart_ptr, "binary response bytes: %d", binary_response_length);
+	UART_transmit_ln_int(huart_ptr, "binary cycles: %d", cycles_binary / TEST_PROTOCOL_RUNS);
+}
+
+/* run time statistics of the scheduler tasks since the start */
+static void Test_Scheduler_statistics(UART_HandleTypeDef *huart_ptr)
+{
+	const Scheduler_task_t *task_ptr;
+
+	for (uint8_t i = 0; i < Scheduler_get_num_of_tasks(); i++)
+	{
+		task_ptr = Scheduler_get_task(i);
+		UART_transmit_ln(huart_ptr, (char*)task_ptr->name);
+		UART_transmit_ln_int(huart_ptr, "  period ms: %d", task_ptr->period_ms);
+		UART_transmit_ln_int(huart_ptr, "  runs: %d", task_ptr->num_of_runs);
+		UART_transmit_ln_int(huart_ptr, "  deadline misses: %d", task_ptr->num_of_deadline_misses);
+		UART_transmit_ln_int(huart_ptr, "  skipped releases: %d", task_ptr->num_of_skipped_releases);
+		UART_transmit_ln_int(huart_ptr, "  max latency ms: %d", task_ptr->max_latency_ms);
+		UART_transmit_ln_int(huart_ptr, "  max cycles: %d", task_ptr->max_execution_cycles);
+	}
+	UART_transmit_ln_int(huart_ptr, "log characters dropped: %d", Log_get_num_of_dropped());
+}
+
+static void Test_Motion_Planner(UART_HandleTypeDef *huart_ptr, Manual_Control_t *mc_ptr)
+{
+	/* long, short, reversed while accelerating, extended while moving */
+	const Test_planner_move_t moves[] = {
+			{ "long", 300.0F, 0U, 300.0F },
+			{ "short", 3.0F, 0U, 3.0F },
+			{ "reversed", 100.0F, 3000U, -50.0F },
+			{ "retargeted", 100.0F, 3000U, 200.0F }
+	};
+
+	/* the limits of the linear guide, the planner of the linear guide is left untouched */
+	for (uint8_t i = 0; i < sizeof(moves) / sizeof(moves[0]); i++)
+	{
+		Test_Motion_Planner_move(huart_ptr, &mc_ptr->lg_ptr->planner.limits, &moves[i]);
+	}
+}
+
+static void Test_Motion_Planner_move(UART_HandleTypeDef *huart_ptr, const Motion_Planner_limits_t *limits_ptr, const Test_planner_move_t *move_ptr)
+{
+	Motion_Planner_t planner = Motion_Planner_init(*limits_ptr);
+	int8_t status = MOTION_PLANNER_MOVING;
+	uint32_t cycle = 0;
+	uint32_t cycles_planner = 0;
+	float position = 0.0F;
+	float velocity = 0.0F;
+	float acceleration = 0.0F;
+	float max_velocity = 0.0F;
+	float max_acceleration = 0.0F;
+	float max_jerk = 0.0F;
+	float error = 0.0F;
+
+	Motion_Planner_set_target_position(&planner, move_ptr->first_target_mm);
+	for (cycle = 0; cycle < TEST_PLANNER_MAX_CYCLES && status != MOTION_PLANNER_STOPPED; cycle++)
+	{
+		if (cycle == move_ptr->retarget_cycle)
+		{
+			Motion_Planner_set_target_position(&planner, move_ptr->second_target_mm);
+		}
+		Test_cycle_counter_start();
+		status = Motion_Planner_update(&planner, position);
+		cycles_planner += Test_cycle_counter_read();
+		/* ideal motor: the position follows the planned velocity */
+		position += (velocity + planner.velocity) / 2.0F * limits_ptr->cycle_time;
+		max_velocity = fmaxf(max_velocity, fabsf(planner.velocity));
+		max_acceleration = fmaxf(max_acceleration, fabsf(planner.acceleration));
+		max_jerk = fmaxf(max_jerk, fabsf(planner.acceleration - acceleration) / limits_ptr->cycle_time);
+		velocity = planner.velocity;
+		acceleration = planner.acceleration;
+	}
+	error = position - move_ptr->second_target_mm;
+
+	UART_transmit_ln(huart_ptr, (char*)move_ptr->name);
+	UART_transmit_ln_int(huart_ptr, "  duration ms: %d", cycle);
+	UART_transmit_ln_int(huart_ptr, "  landing error um: %d", lroundf(error * 1000.0F));
+	UART_transmit_ln_int(huart_ptr, "  planner cycles per update: %d", cycles_planner / cycle);
+	if (status != MOTION_PLANNER_STOPPED)
+	{
+		UART_transmit_ln(huart_ptr, "  did not stop!");
+	}
+	if (fabsf(error) > TEST_PLANNER_MAX_ERROR_MM)
+	{
+		UART_transmit_ln(huart_ptr, "  landing error above one motor pulse!");
+	}
+	if (max_velocity > limits_ptr->max_velocity * TEST_PLANNER_LIMIT_SLACK)
+	{
+		UART_transmit_ln(huart_ptr, "  velocity limit exceeded!");
+	}
+	if (max_acceleration > limits_ptr->max_acceleration * TEST_PLANNER_LIMIT_SLACK)
+	{
+		UART_transmit_ln(huart_ptr, "  acceleration limit exceeded!");
+	}
+	if (max_jerk > limits_ptr->max_jerk * TEST_PLANNER_LIMIT_SLACK)
+	{
+		UART_transmit_ln(huart_ptr, "  jerk limit exceeded!");
+	}
+}
+
+static void Test_tcp_server_idle_request(UART_HandleTypeDef *huart_ptr)
+{
+	struct tcp_pcb_listen *listen_pcb = tcp_listen_pcbs.listen_pcbs;
+	struct tcp_pcb *pcb = NULL;
+	struct pbuf *p = NULL;
+	uint8_t num_of_free_slots = tcp_server_get_num_of_free_slots();
+	uint8_t polls = 0;
+
+	/* the test plays the lwIP stack: it accepts a connection, passes a header without the
+	 * empty line and polls until the server gives the slot back */
+	while ((listen_pcb != NULL) && (listen_pcb->local_port != TEST_TCP_SERVER_PORT))
+	{
+		listen_pcb = listen_pcb->next;
+	}
+	if ((listen_pcb == NULL) || (num_of_free_slots == 0))
+	{
+		UART_transmit_ln(huart_ptr, "REST server not listening or no free slot!");
+		return;
+	}
+	pcb = tcp_new();
+	p = pbuf_alloc(PBUF_RAW, strlen(TEST_TCP_SERVER_PARTIAL_REQUEST), PBUF_RAM);
+	if ((pcb == NULL) || (p == NULL))
+	{
+		UART_transmit_ln(huart_ptr, "no memory for the connection!");
+		if (pcb != NULL)
+		{
+			tcp_abort(pcb);
+		}
+		if (p != NULL)
+		{
+			pbuf_free(p);
+		}
+		return;
+	}
+	pbuf_take(p, TEST_TCP_SERVER_PARTIAL_REQUEST, p->tot_len);
+	if (listen_pcb->accept(listen_pcb->callback_arg, pcb, ERR_OK) != ERR_OK)
+	{
+		/* the pcb is aborted by the server */
+		UART_transmit_ln(huart_ptr, "connection refused!");
+		pbuf_free(p);
+		return;
+	}
+	pcb->recv(pcb->callback_arg, pcb, p, ERR_OK);
+	UART_transmit_ln_int(huart_ptr, "free slots with partial request: %d", tcp_server_get_num_of_free_slots());
+
+	/* the pcb is freed by the server together with the slot */
+	while ((tcp_server_get_num_of_free_slots() < num_of_free_slots) && (polls < TEST_TCP_SERVER_MAX_POLLS))
+	{
+		pcb->poll(pcb->callback_arg, pcb);
+		polls++;
+	}
+	UART_transmit_ln_int(huart_ptr, "polls until the slot is free: %d", polls);
+	if (tcp_server_get_num_of_free_slots() < num_of_free_slots)
+	{
+		UART_transmit_ln(huart_ptr, "slot of the idle client not freed!");
+		tcp_abort(pcb);
+	}
+}
+
+/* the counter is not reset, the scheduler measures the task that runs the test with it */
+static void Test_cycle_counter_start(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	Test_cycle_counter_start_value = DWT->CYCCNT;
+}
+
+static uint32_t Test_cycle_counter_read(void)
+{
+	return DWT->CYCCNT - Test_cycle_counter_start_value;
+}
@@ -0,0 +1,94 @@
+/**
+ * \file udp_publisher.c
+ * @date 17 Oct 2026
+ * @brief cyclic telemetry datagrams for any number of listeners
+ */
+
+#include "udp.h"
+#include "lwip.h"
+#include "lwip/sys.h"
+#include "Binary_Protocol.h"
+#include "FRAM.h"
+#include "FRAM_memory_mapping.h"
+#include "udp_publisher.h"
+
+/* limited broadcast, a multicast group (e.g. 239.0.0.123) works without further changes */
+#define UDP_PUBLISHER_DESTINATION  LWIP_MAKEU32(255, 255, 255, 255)
+
+static struct udp_pcb *udp_publisher_pcb = NULL;
+static ip_addr_t udp_publisher_destination;
+static uint16_t udp_publisher_interval_ms = UDP_PUBLISHER_DEFAULT_INTERVAL_MS;
+static uint32_t udp_publisher_last_ms = 0U;
+static uint32_t udp_publisher_sequence = 0U;
+
+/**
+ * @brief  This function builds the datagram of the latest telemetry snapshot and sends it
+ * @param  None
+ * @retval None
+ */
+static void udp_publisher_send(void);
+
+/**
+ * @brief  This function reads the saved publishing rate
+ * @param  None
+ * @retval period of the datagrams, UDP_PUBLISHER_DEFAULT_INTERVAL_MS if the FRAM holds none
+ */
+static uint16_t udp_publisher_read_interval(void);
+
+void udp_publisher_init(void) {
+  udp_publisher_interval_ms = udp_publisher_read_interval();
+  udp_publisher_pcb = udp_new();
+  ip4_addr_set_u32(ip_2_ip4(&udp_publisher_destination), PP_HTONL(UDP_PUBLISHER_DESTINATION));
+  udp_publisher_last_ms = sys_now();
+}
+
+void udp_publisher_update(void) {
+  uint32_t now_ms = sys_now();
+
+  if ((udp_publisher_pcb == NULL) || (now_ms - udp_publisher_last_ms < udp_publisher_interval_ms)) {
+    return;
+  }
+  udp_publisher_last_ms = now_ms;
+  udp_publisher_send();
+}
+
+void udp_publisher_set_interval(uint16_t interval_ms) {
+  if (interval_ms < UDP_PUBLISHER_MIN_INTERVAL_MS) {
+    interval_ms = UDP_PUBLISHER_MIN_INTERVAL_MS;
+  } else if (interval_ms > UDP_PUBLISHER_MAX_INTERVAL_MS) {
+    interval_ms = UDP_PUBLISHER_MAX_INTERVAL_MS;
+  }
+  udp_publisher_interval_ms = interval_ms;
+  FRAM_write((uint8_t*) &udp_publisher_interval_ms, FRAM_UDP_INTERVAL, sizeof(udp_publisher_interval_ms));
+}
+
+uint16_t udp_publisher_get_interval(void) {
+  return udp_publisher_interval_ms;
+}
+
+static uint16_t udp_publisher_read_interval(void) {
+  uint16_t interval_ms = 0U;
+
+  /* an empty FRAM reads 0, which is below the minimum */
+  FRAM_read(FRAM_UDP_INTERVAL, (uint8_t*) &interval_ms, sizeof(interval_ms));
+  if ((interval_ms < UDP_PUBLISHER_MIN_INTERVAL_MS) || (interval_ms > UDP_PUBLISHER_MAX_INTERVAL_MS)) {
+    return UDP_PUBLISHER_DEFAULT_INTERVAL_MS;
+  }
+  return interval_ms;
+}
+
+static void udp_publisher_send(void) {
+  Binary_Protocol_frame_t frame;
+  struct pbuf *p;
+  u16_t length = BINARY_PROTOCOL_HEADER_SIZE + BINARY_PROTOCOL_TELEMETRY_SIZE + BINARY_PROTOCOL_CRC_SIZE;
+
+  /* when the heap is short the datagram is skipped, the next one follows anyway */
+  p = pbuf_alloc(PBUF_TRANSPORT, length, PBUF_RAM);
+  if (p == NULL) {
+    return;
+  }
+  Binary_Protocol_create_telemetry(&frame, udp_publisher_sequence++);
+  (void) Binary_Protocol_encode(&frame, (uint8_t*) p->payload, length);
+  (void) udp_sendto(udp_publisher_pcb, p, &udp_publisher_destination, UDP_PUBLISHER_PORT);
+  pbuf_free(p);
+}
@@ -0,0 +1,51 @@
+/**
+ * \file udp_publisher.h
+ * @date 17 Oct 2026
+ * @brief cyclic telemetry datagrams for any number of listeners
+ *
+ * The datagram is a BINARY_PROTOCOL_TELEMETRY frame (see Binary_Protocol.h). It is sent to the
+ * broadcast address by default, so consumers only listen on UDP_PUBLISHER_PORT and the server
+ * keeps no state per consumer.
+ */
+
+#ifndef UDP_UDP_PUBLISHER_H_
+#define UDP_UDP_PUBLISHER_H_
+
+#include <stdint.h>
+
+#define UDP_PUBLISHER_PORT                 2377
+#define UDP_PUBLISHER_DEFAULT_INTERVAL_MS  100U
+#define UDP_PUBLISHER_MIN_INTERVAL_MS      10U
+#define UDP_PUBLISHER_MAX_INTERVAL_MS      60000U
+
+/**
+ * @brief  Creates the UDP pcb and starts publishing with the interval saved in the FRAM,
+ *         UDP_PUBLISHER_DEFAULT_INTERVAL_MS if none is saved
+ * @param  None
+ * @retval None
+ */
+void udp_publisher_init(void);
+
+/**
+ * @brief  Sends the telemetry datagram when it is due, to be called in the main loop
+ * @param  None
+ * @retval None
+ */
+void udp_publisher_update(void);
+
+/**
+ * @brief  Changes the publishing rate and saves it in the FRAM
+ * @param  interval_ms: period of the datagrams, limited to UDP_PUBLISHER_MIN_INTERVAL_MS and
+ *         UDP_PUBLISHER_MAX_INTERVAL_MS
+ * @retval None
+ */
+void udp_publisher_set_interval(uint16_t interval_ms);
+
+/**
+ * @brief  Returns the publishing rate
+ * @param  None
+ * @retval period of the datagrams in ms
+ */
+uint16_t udp_publisher_get_interval(void);
+
+#endif /* UDP_UDP_PUBLISHER_H_ */
@@ -0,0 +1,309 @@
+/**
+ * \file NMEA.c
+ * @date 17 Oct 2026
+ * @brief Incremental parser for NMEA 0183 MWV (wind speed and angle) sentences
+ */
+#include "NMEA.h"
+#include <string.h>
+
+/* defines -----------------------------------------------------------*/
+#define NMEA_START_DELIMITER        '$'
+#define NMEA_FIELD_DELIMITER        ','
+#define NMEA_CHECKSUM_DELIMITER     '*'
+#define NMEA_MWV_FORMATTER          "MWV"
+#define NMEA_FORMATTER_OFFSET       2U   /* sentence formatter behind the talker ID */
+#define NMEA_STATUS_VALID           'A'
+#define NMEA_MAX_ANGLE_X10          3600U
+
+/* $--MWV,<angle>,<reference>,<speed>,<unit>,<status>*hh */
+#define NMEA_MWV_FIELD_ANGLE        0U
+#define NMEA_MWV_FIELD_REFERENCE    1U
+#define NMEA_MWV_FIELD_SPEED        2U
+#define NMEA_MWV_FIELD_UNIT         3U
+#define NMEA_MWV_FIELD_STATUS       4U
+#define NMEA_MWV_ANGLE_DECIMALS     1    /* 10^1 = NMEA_MWV_ANGLE_SCALE */
+#define NMEA_MWV_SPEED_DECIMALS     2    /* 10^2 = NMEA_MWV_SPEED_SCALE */
+
+/* private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief clear the accumulated value of the current field
+ * @param parser_ptr: ptr to the parser instance
+ * @retval none
+ */
+static void NMEA_reset_field(NMEA_parser_t *parser_ptr);
+
+/**
+ * @brief process one byte of a data field
+ * @param parser_ptr: ptr to the parser instance
+ * @param byte: received byte
+ * @retval none
+ */
+static void NMEA_parse_field_byte(NMEA_parser_t *parser_ptr, char byte);
+
+/**
+ * @brief accumulate one byte of a decimal number, decimals beyond max_decimals are truncated
+ * @param parser_ptr: ptr to the parser instance
+ * @param byte: received byte
+ * @param max_decimals: number of decimals that are kept
+ * @retval none
+ */
+static void NMEA_parse_digit(NMEA_parser_t *parser_ptr, char byte, int8_t max_decimals);
+
+/**
+ * @brief check and store the current field after its delimiter was received
+ * @param parser_ptr: ptr to the parser instance
+ * @retval none
+ */
+static void NMEA_finish_field(NMEA_parser_t *parser_ptr);
+
+/**
+ * @brief scale the accumulated number of the current field to a fixed number of decimals
+ * @param parser_ptr: ptr to the parser instance
+ * @param decimals: number of decimals of the result
+ * @param value_ptr: ptr to the destination
+ * @retval False if the field is empty or the value overflows
+ */
+static boolean_t NMEA_field_to_fixed_point(NMEA_parser_t *parser_ptr, int8_t decimals, uint32_t *value_ptr);
+
+/**
+ * @brief convert a hexadecimal digit of the checksum
+ * @param byte: received byte
+ * @retval 0 ... 15 or -1 if byte is no hexadecimal digit
+ */
+static int8_t NMEA_hex_value(char byte);
+
+/**
+ * @brief evaluate the sentence after the checksum was received
+ * @param parser_ptr: ptr to the parser instance
+ * @param mwv_ptr: ptr to the destination
+ * @retval NMEA_result_valid or NMEA_result_invalid
+ */
+static NMEA_result_t NMEA_finish_sentence(NMEA_parser_t *parser_ptr, NMEA_MWV_t *mwv_ptr);
+
+/* API function definitions -----------------------------------------------*/
+
+void NMEA_init(NMEA_parser_t *parser_ptr) {
+  memset(parser_ptr, 0, sizeof(NMEA_parser_t));
+  parser_ptr->state = NMEA_state_idle;
+}
+
+NMEA_result_t NMEA_parse_byte(NMEA_parser_t *parser_ptr, char byte, NMEA_MWV_t *mwv_ptr) {
+  int8_t hex = 0;
+
+  if (byte == NMEA_START_DELIMITER) {
+    /* a start delimiter always begins a new sentence, even inside an incomplete one */
+    NMEA_init(parser_ptr);
+    parser_ptr->state = NMEA_state_address;
+    parser_ptr->length = 1U;
+    return NMEA_result_pending;
+  }
+  if (parser_ptr->state == NMEA_state_idle) {
+    return NMEA_result_pending;
+  }
+  if (++parser_ptr->length > NMEA_SENTENCE_MAX_SIZE) {
+    parser_ptr->state = NMEA_state_idle;
+    return NMEA_result_invalid;
+  }
+  switch (parser_ptr->state) {
+    case NMEA_state_address:
+      if (byte == NMEA_FIELD_DELIMITER) {
+        if (parser_ptr->field_length != NMEA_ADDRESS_SIZE
+            || memcmp(&parser_ptr->address[NMEA_FORMATTER_OFFSET], NMEA_MWV_FORMATTER,
+                      NMEA_ADDRESS_SIZE - NMEA_FORMATTER_OFFSET) != 0) {
+          /* other sentences of the sensor are skipped */
+          parser_ptr->state = NMEA_state_idle;
+          return NMEA_result_pending;
+        }
+        parser_ptr->checksum ^= (uint8_t) byte;
+        parser_ptr->state = NMEA_state_field;
+        NMEA_reset_field(parser_ptr);
+        return NMEA_result_pending;
+      }
+      if (parser_ptr->field_length >= NMEA_ADDRESS_SIZE || byte < 'A' || byte > 'Z') {
+        parser_ptr->state = NMEA_state_idle;
+        return NMEA_result_invalid;
+      }
+      parser_ptr->address[parser_ptr->field_length++] = byte;
+      parser_ptr->checksum ^= (uint8_t) byte;
+      return NMEA_result_pending;
+    case NMEA_state_field:
+      if (byte == NMEA_CHECKSUM_DELIMITER) {
+        NMEA_finish_field(parser_ptr);
+        parser_ptr->state = NMEA_state_checksum_high;
+        return NMEA_result_pending;
+      }
+      if (byte == '\r' || byte == '\n') {
+        /* the checksum is mandatory */
+        parser_ptr->state = NMEA_state_idle;
+        return NMEA_result_invalid;
+      }
+      parser_ptr->checksum ^= (uint8_t) byte;
+      if (byte == NMEA_FIELD_DELIMITER) {
+        NMEA_finish_field(parser_ptr);
+        parser_ptr->field_index++;
+        NMEA_reset_field(parser_ptr);
+      }
+      else {
+        NMEA_parse_field_byte(parser_ptr, byte);
+      }
+      return NMEA_result_pending;
+    case NMEA_state_checksum_high:
+      hex = NMEA_hex_value(byte);
+      if (hex < 0) {
+        parser_ptr->state = NMEA_state_idle;
+        return NMEA_result_invalid;
+      }
+      parser_ptr->received_checksum = (uint8_t) hex << 4;
+      parser_ptr->state = NMEA_state_checksum_low;
+      return NMEA_result_pending;
+    case NMEA_state_checksum_low:
+      hex = NMEA_hex_value(byte);
+      parser_ptr->state = NMEA_state_idle;
+      if (hex < 0) {
+        return NMEA_result_invalid;
+      }
+      parser_ptr->received_checksum |= (uint8_t) hex;
+      return NMEA_finish_sentence(parser_ptr, mwv_ptr);
+    default:
+      parser_ptr->state = NMEA_state_idle;
+      return NMEA_result_pending;
+  }
+}
+
+/* private function definitions -----------------------------------------------*/
+
+static void NMEA_reset_field(NMEA_parser_t *parser_ptr) {
+  parser_ptr->field_length = 0U;
+  parser_ptr->value = 0U;
+  parser_ptr->decimals = -1;
+}
+
+static void NMEA_parse_field_byte(NMEA_parser_t *parser_ptr, char byte) {
+  parser_ptr->field_length++;
+  switch (parser_ptr->field_index) {
+    case NMEA_MWV_FIELD_ANGLE:
+      NMEA_parse_digit(parser_ptr, byte, NMEA_MWV_ANGLE_DECIMALS);
+      break;
+    case NMEA_MWV_FIELD_REFERENCE:
+      parser_ptr->mwv.reference = byte;
+      break;
+    case NMEA_MWV_FIELD_SPEED:
+      NMEA_parse_digit(parser_ptr, byte, NMEA_MWV_SPEED_DECIMALS);
+      break;
+    case NMEA_MWV_FIELD_UNIT:
+      parser_ptr->mwv.unit = (NMEA_unit_t) byte;
+      break;
+    case NMEA_MWV_FIELD_STATUS:
+      parser_ptr->status = byte;
+      break;
+    default:
+      parser_ptr->is_malformed = True;
+      break;
+  }
+}
+
+static void NMEA_parse_digit(NMEA_parser_t *parser_ptr, char byte, int8_t max_decimals) {
+  if (byte == '.') {
+    if (parser_ptr->decimals >= 0) {
+      parser_ptr->is_malformed = True;
+    }
+    parser_ptr->decimals = 0;
+    return;
+  }
+  if (byte < '0' || byte > '9') {
+    parser_ptr->is_malformed = True;
+    return;
+  }
+  if (parser_ptr->decimals >= max_decimals) {
+    return;
+  }
+  if (parser_ptr->value > (UINT32_MAX - 9U) / 10U) {
+    parser_ptr->is_malformed = True;
+    return;
+  }
+  parser_ptr->value = parser_ptr->value * 10U + (uint32_t) (byte - '0');
+  if (parser_ptr->decimals >= 0) {
+    parser_ptr->decimals++;
+  }
+}
+
+static void NMEA_finish_field(NMEA_parser_t *parser_ptr) {
+  uint32_t value = 0U;
+
+  switch (parser_ptr->field_index) {
+    case NMEA_MWV_FIELD_ANGLE:
+      if (!NMEA_field_to_fixed_point(parser_ptr, NMEA_MWV_ANGLE_DECIMALS, &value)
+          || value >= NMEA_MAX_ANGLE_X10) {
+        parser_ptr->is_malformed = True;
+      }
+      parser_ptr->mwv.angle_x10 = (uint16_t) value;
+      break;
+    case NMEA_MWV_FIELD_SPEED:
+      if (!NMEA_field_to_fixed_point(parser_ptr, NMEA_MWV_SPEED_DECIMALS, &value)) {
+        parser_ptr->is_malformed = True;
+      }
+      parser_ptr->mwv.speed_x100 = value;
+      break;
+    case NMEA_MWV_FIELD_REFERENCE:
+      if (parser_ptr->field_length != 1U
+          || (parser_ptr->mwv.reference != 'R' && parser_ptr->mwv.reference != 'T')) {
+        parser_ptr->is_malformed = True;
+      }
+      break;
+    case NMEA_MWV_FIELD_UNIT:
+      if (parser_ptr->field_length != 1U
+          || (parser_ptr->mwv.unit != NMEA_unit_kmh && parser_ptr->mwv.unit != NMEA_unit_mps
+              && parser_ptr->mwv.unit != NMEA_unit_knots && parser_ptr->mwv.unit != NMEA_unit_mph)) {
+        parser_ptr->is_malformed = True;
+      }
+      break;
+    case NMEA_MWV_FIELD_STATUS:
+      if (parser_ptr->field_length != 1U) {
+        parser_ptr->is_malformed = True;
+      }
+      break;
+    default:
+      parser_ptr->is_malformed = True;
+      break;
+  }
+}
+
+static boolean_t NMEA_field_to_fixed_point(NMEA_parser_t *parser_ptr, int8_t decimals, uint32_t *value_ptr) {
+  uint32_t value = parser_ptr->value;
+
+  if (parser_ptr->field_length == 0U) {
+    return False;
+  }
+  for (int8_t i = parser_ptr->decimals < 0 ? 0 : parser_ptr->decimals; i < decimals; i++) {
+    if (value > UINT32_MAX / 10U) {
+      return False;
+    }
+    value *= 10U;
+  }
+  *value_ptr = value;
+  return True;
+}
+
+static int8_t NMEA_hex_value(char byte) {
+  if (byte >= '0' && byte <= '9') {
+    return (int8_t) (byte - '0');
+  }
+  if (byte >= 'A' && byte <= 'F') {
+    return (int8_t) (byte - 'A' + 10);
+  }
+  if (byte >= 'a' && byte <= 'f') {
+    return (int8_t) (byte - 'a' + 10);
+  }
+  return -1;
+}
+
+static NMEA_result_t NMEA_finish_sentence(NMEA_parser_t *parser_ptr, NMEA_MWV_t *mwv_ptr) {
+  if (parser_ptr->checksum != parser_ptr->received_checksum || parser_ptr->is_malformed
+      || parser_ptr->field_index != NMEA_MWV_FIELD_STATUS
+      || parser_ptr->status != NMEA_STATUS_VALID) {
+    return NMEA_result_invalid;
+  }
+  *mwv_ptr = parser_ptr->mwv;
+  return NMEA_result_valid;
+}
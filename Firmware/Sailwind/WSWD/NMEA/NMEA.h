@@ -0,0 +1,126 @@
+/**
+ * \file NMEA.h
+ * @date 17 Oct 2026
+ * @brief Incremental parser for NMEA 0183 MWV (wind speed and angle) sentences
+ *
+ * The parser is fed one byte at a time and keeps its state between calls, so a sentence
+ * may arrive in any number of fragments. Fields may have any width, the checksum is verified
+ * and the values are converted to fixed-point without libc float parsing.
+ * It has no hardware dependencies.
+ */
+
+#ifndef WSWD_NMEA_H_
+#define WSWD_NMEA_H_
+
+#include <stdint.h>
+#include "boolean.h"
+
+/* defines -----------------------------------------------------------*/
+#define NMEA_SENTENCE_MAX_SIZE  82U  /* maximum sentence length including "$" and "\r\n" */
+#define NMEA_ADDRESS_SIZE       5U   /* talker ID (2) + sentence formatter (3) */
+#define NMEA_MWV_ANGLE_SCALE    10   /* NMEA_MWV_t::angle_x10 is given in 0.1 degree */
+#define NMEA_MWV_SPEED_SCALE    100  /* NMEA_MWV_t::speed_x100 is given in 0.01 speed units */
+
+/* typedefs -----------------------------------------------------------*/
+
+typedef enum {
+  NMEA_result_pending,  /* sentence not complete yet or not a MWV sentence */
+  NMEA_result_valid,    /* complete MWV sentence with valid checksum and status 'A' */
+  NMEA_result_invalid   /* malformed sentence, checksum mismatch or status 'V' */
+} NMEA_result_t;
+
+typedef enum {
+  NMEA_unit_kmh = 'K',
+  NMEA_unit_mps = 'M',
+  NMEA_unit_knots = 'N',
+  NMEA_unit_mph = 'S'
+} NMEA_unit_t;
+
+typedef enum {
+  NMEA_state_idle,
+  NMEA_state_address,
+  NMEA_state_field,
+  NMEA_state_checksum_high,
+  NMEA_state_checksum_low
+} NMEA_state_t;
+
+/** @struct NMEA_MWV_t
+ *  @brief content of a MWV sentence
+ *  @var NMEA_MWV_t::angle_x10
+ *  wind angle in 0.1 degree (0 ... 3599)
+ *  @var NMEA_MWV_t::speed_x100
+ *  wind speed in 0.01 of unit
+ *  @var NMEA_MWV_t::reference
+ *  'R' relative or 'T' theoretical wind
+ *  @var NMEA_MWV_t::unit
+ *  unit of the wind speed
+ */
+typedef struct {
+  uint16_t angle_x10;
+  uint32_t speed_x100;
+  char reference;
+  NMEA_unit_t unit;
+} NMEA_MWV_t;
+
+/** @struct NMEA_parser_t
+ *  @brief state of the parser between two bytes
+ *  @var NMEA_parser_t::state
+ *  part of the sentence the next byte belongs to
+ *  @var NMEA_parser_t::address
+ *  talker ID and sentence formatter
+ *  @var NMEA_parser_t::length
+ *  number of bytes of the current sentence
+ *  @var NMEA_parser_t::checksum
+ *  XOR of all bytes between '$' and '*'
+ *  @var NMEA_parser_t::received_checksum
+ *  checksum transmitted behind '*'
+ *  @var NMEA_parser_t::field_index
+ *  index of the current data field
+ *  @var NMEA_parser_t::field_length
+ *  number of bytes of the current data field
+ *  @var NMEA_parser_t::value
+ *  fixed-point value of the current numeric field
+ *  @var NMEA_parser_t::decimals
+ *  number of decimals of value, -1 while no decimal point was received
+ *  @var NMEA_parser_t::status
+ *  status field of the sentence
+ *  @var NMEA_parser_t::is_malformed
+ *  set on the first syntax error, the sentence is reported invalid at its end
+ *  @var NMEA_parser_t::mwv
+ *  values of the current sentence
+ */
+typedef struct {
+  NMEA_state_t state;
+  char address[NMEA_ADDRESS_SIZE];
+  uint8_t length;
+  uint8_t checksum;
+  uint8_t received_checksum;
+  uint8_t field_index;
+  uint8_t field_length;
+  uint32_t value;
+  int8_t decimals;
+  char status;
+  boolean_t is_malformed;
+  NMEA_MWV_t mwv;
+} NMEA_parser_t;
+
+/* API function prototypes -----------------------------------------------*/
+
+/**
+ * @brief reset the parser, so it waits for the next '$'
+ * @param parser_ptr: ptr to the parser instance
+ * @retval none
+ */
+void NMEA_init(NMEA_parser_t *parser_ptr);
+
+/**
+ * @brief feed one received byte into the parser
+ * @param parser_ptr: ptr to the parser instance
+ * @param byte: received byte
+ * @param mwv_ptr: ptr to the destination, only written if NMEA_result_valid is returned
+ * @retval NMEA_result_valid at the end of a valid MWV sentence,
+ *         NMEA_result_invalid at the end of an invalid one, NMEA_result_pending otherwise
+ */
+NMEA_result_t NMEA_parse_byte(NMEA_parser_t *parser_ptr, char byte, NMEA_MWV_t *mwv_ptr);
+
+#endif /* WSWD_NMEA_H_ */
@@ -1,23 +1,46 @@
 /**
  * \file WSWD.c
  * @date 18 Jun 2023
- * @brief Access to Analog and Digital IO Pins
+ * @brief Access to the wind sensor (WSWD) over rs485
  */
 
 #include <stdio.h>
 #include <string.h>
-#include <stdlib.h>
 #include "WSWD.h"
 #include "main.h"
 
 #define WSWD_ID                         "00"
 #define SIZE_OF_WSWD_ID                 2U
 #define SIZE_OF_WSWD_ANSWER             11U
-#define SIZE_OF_NMEA_TELEGRAM           31U
 #define SIZE_OF_WSWD_COMMAND            6U
 #define SIZE_OF_WSWD_COMMAND_WITH_PARAM 7U
 #define SIZE_OF_WSWD_PARAM              5U
 #define WSWD_UART_TIMEOUT               1000U
+#define WSWD_RING_BUFFER_MASK           (WSWD_RING_BUFFER_SIZE - 1U)
+
+/* private variables -----------------------------------------------------------*/
+static UART_HandleTypeDef *WSWD_huart_ptr = NULL;
+static uint8_t WSWD_dma_buffer[WSWD_DMA_BUFFER_SIZE];
+static uint16_t WSWD_dma_position = 0U;
+
+/* bytes are written by the uart interrupt (head) and parsed in WSWD_update (tail) */
+static uint8_t WSWD_ring_buffer[WSWD_RING_BUFFER_SIZE];
+static volatile uint16_t WSWD_ring_head = 0U;
+static uint16_t WSWD_ring_tail = 0U;
+static volatile boolean_t WSWD_ring_overflow = False;
+
+static NMEA_parser_t WSWD_parser = { 0 };
+
+static WSWD_wind_sample_t WSWD_latest_sample = { 0 };
+static Wind_History_t WSWD_history;
+static const Wind_History_config_t WSWD_history_config = {
+    .window_durations_ms = { WSWD_WINDOW_SHORT_MS, WSWD_WINDOW_LONG_MS },
+    .gust_delta_x100 = WSWD_GUST_DELTA_X100
+};
+/* the statistics are valid until a new sample arrives or the lifetime is over */
+static Wind_History_statistics_t WSWD_statistics[Wind_History_num_of_windows];
+static uint32_t WSWD_statistics_timestamp_ms = 0U;
+static uint32_t WSWD_statistics_lifetime_ms = 0U;
 
 /**
  * @brief Set pin to receive incoming rs485 transmission
@@ -33,6 +56,19 @@ static void WSWD_enable_receive(void);
  */
 static void WSWD_enable_send(void);
 
+/**
+ * @brief (re)start the DMA reception with idle line detection
+ * @param none
+ * @retval WSWD_OK or WSWD_ERROR
+ */
+static uint8_t WSWD_start_reception(void);
+
+/**
+ * @brief recompute the statistics of every window and the time until they change without a new sample
+ * @param now_ms: current tick
+ * @retval none
+ */
+static void WSWD_update_statistics(uint32_t now_ms);
 
 static void WSWD_enable_receive(void) {
   if (HAL_GPIO_ReadPin(Windsensor_EN_GPIO_Port, Windsensor_EN_Pin)
@@ -85,73 +121,147 @@ uint8_t WSWD_send_with_param(char* command, char* param)
   return HAL_OK;
 }
 
-uint8_t WSWD_receive(char* receive_buffer, uint8_t size_of_receive_buffer)
+uint8_t WSWD_init(UART_HandleTypeDef *huart_ptr)
 {
+  WSWD_huart_ptr = huart_ptr;
+  NMEA_init(&WSWD_parser);
+  Wind_History_init(&WSWD_history, &WSWD_history_config);
+  WSWD_update_statistics(HAL_GetTick());
   WSWD_enable_receive();
-  if(HAL_UART_Receive(&huart2, (uint8_t*)receive_buffer, size_of_receive_buffer, WSWD_UART_TIMEOUT) != HAL_OK)
-  {
-    printf("error sending to WSWD\r\n");
-  }
-  return HAL_OK;
+  return WSWD_start_reception();
 }
 
-uint8_t WSWD_receive_NMEA(char* receive_buffer)
+void WSWD_update(void)
 {
-  if(HAL_UART_Receive(&huart2, (uint8_t*)receive_buffer, SIZE_OF_NMEA_TELEGRAM, WSWD_UART_TIMEOUT) != HAL_OK)
+  uint16_t head = WSWD_ring_head;
+  NMEA_MWV_t mwv;
+  NMEA_result_t result = NMEA_result_pending;
+  boolean_t is_new_sample = False;
+  uint32_t now_ms;
+
+  if (WSWD_ring_overflow)
   {
-    printf("error receiving from WSWD\r\n");
+    /* bytes were dropped, so the sentence in progress is incomplete */
+    WSWD_ring_overflow = False;
+    NMEA_init(&WSWD_parser);
+  }
+  while (WSWD_ring_tail != head)
+  {
+    result = NMEA_parse_byte(&WSWD_parser, (char)WSWD_ring_buffer[WSWD_ring_tail], &mwv);
+    WSWD_ring_tail = (WSWD_ring_tail + 1U) & WSWD_RING_BUFFER_MASK;
+    if (result == NMEA_result_valid)
+    {
+      WSWD_latest_sample.speed_x100 = mwv.speed_x100;
+      WSWD_latest_sample.direction_x10 = mwv.angle_x10;
+      WSWD_latest_sample.unit = mwv.unit;
+      WSWD_latest_sample.timestamp_ms = HAL_GetTick();
+      WSWD_latest_sample.is_valid = True;
+      Wind_History_add(&WSWD_history, WSWD_latest_sample.timestamp_ms, mwv.speed_x100, mwv.angle_x10);
+      is_new_sample = True;
+    }
+    else if (result == NMEA_result_invalid)
+    {
+      printf("error telegram invalid\r\n");
+    }
+  }
+  now_ms = HAL_GetTick();
+  if (is_new_sample || now_ms - WSWD_statistics_timestamp_ms >= WSWD_statistics_lifetime_ms)
+  {
+    WSWD_update_statistics(now_ms);
   }
-  return HAL_OK;
 }
 
-void WSWD_get_wind_infos(char* received_NMEA_telegramm, float *Windspeed,  float *Winddirection)
+uint8_t WSWD_get_latest_sample(WSWD_wind_sample_t *sample)
 {
-  char Windspeed_buffer[6];
-  char Winddirection_buffer[5];
-  if(received_NMEA_telegramm[25] == 'A')
-  {
-    memcpy(Winddirection_buffer, &received_NMEA_telegramm[8], 5);
-    memcpy(Windspeed_buffer, &received_NMEA_telegramm[16], 6);
-    *Winddirection = (float)atof(Winddirection_buffer);
-    *Windspeed = (float)atof(Windspeed_buffer);
-  }
-  else
+  assert(sample != 0);
+
+  *sample = WSWD_latest_sample;
+  if (!sample->is_valid || HAL_GetTick() - sample->timestamp_ms > WSWD_SAMPLE_TIMEOUT_MS)
   {
-    printf("error telegram invalid\r\n");
-    printf("%s\r\n", received_NMEA_telegramm);
+    return WSWD_NO_DATA;
   }
+  return WSWD_OK;
+}
+
+uint8_t WSWD_get_wind_statistics(Wind_History_window_t window, Wind_History_statistics_t *statistics)
+{
+  assert(statistics != 0);
+
+  *statistics = WSWD_statistics[window];
+  return statistics->num_of_samples == 0U ? WSWD_NO_DATA : WSWD_OK;
 }
 
-void WSWD_get_windspeed_unit(char* received_NMEA_telegramm, char unit)
+void WSWD_get_gust(Wind_History_gust_t *gust)
 {
-  unit = received_NMEA_telegramm[23];
+  assert(gust != 0);
+
+  *gust = WSWD_history.gust;
 }
 
-void WSWD_get_wind_speed(char* received_NMEA_telegramm, float *Windspeed)
+void WSWD_callback_receive_event(UART_HandleTypeDef *huart_ptr, uint16_t position)
 {
-  char Windspeed_buffer[6];
-  if(received_NMEA_telegramm[25] == 'A')
+  uint16_t next_head = 0U;
+
+  if (huart_ptr != WSWD_huart_ptr)
+  {
+    return;
+  }
+  /* position is the end of the new data in the DMA buffer, the buffer size after a wrap around */
+  if (position >= WSWD_DMA_BUFFER_SIZE)
+  {
+    position = 0U;
+  }
+  while (WSWD_dma_position != position)
   {
-    memcpy(Windspeed_buffer, &received_NMEA_telegramm[16], 6);
-    *Windspeed = (float)atof(Windspeed_buffer);
+    next_head = (WSWD_ring_head + 1U) & WSWD_RING_BUFFER_MASK;
+    if (next_head == WSWD_ring_tail)
+    {
+      WSWD_ring_overflow = True;
+    }
+    else
+    {
+      WSWD_ring_buffer[WSWD_ring_head] = WSWD_dma_buffer[WSWD_dma_position];
+      WSWD_ring_head = next_head;
+    }
+    WSWD_dma_position = (WSWD_dma_position + 1U) % WSWD_DMA_BUFFER_SIZE;
   }
-  else
+}
+
+void WSWD_callback_error(UART_HandleTypeDef *huart_ptr)
+{
+  if (huart_ptr != WSWD_huart_ptr)
   {
-    printf("error telegram invalid\r\n");
+    return;
   }
+  HAL_UART_AbortReceive(huart_ptr);
+  WSWD_ring_overflow = True;
+  (void)WSWD_start_reception();
 }
 
-void WSWD_get_wind_dir(char* received_NMEA_telegramm, float *Winddirection)
+static uint8_t WSWD_start_reception(void)
 {
-  char Winddirection_buffer[5];
-  if(received_NMEA_telegramm[25] == 'A')
+  WSWD_dma_position = 0U;
+  if (HAL_UARTEx_ReceiveToIdle_DMA(WSWD_huart_ptr, WSWD_dma_buffer, WSWD_DMA_BUFFER_SIZE) != HAL_OK)
   {
-    memcpy(Winddirection_buffer, &received_NMEA_telegramm[8], 5);
-    *Winddirection = (float)atof(Winddirection_buffer);
+    printf("error starting reception from WSWD\r\n");
+    return WSWD_ERROR;
   }
-  else
+  return WSWD_OK;
+}
+
+static void WSWD_update_statistics(uint32_t now_ms)
+{
+  uint32_t time_to_expiry;
+
+  WSWD_statistics_timestamp_ms = now_ms;
+  WSWD_statistics_lifetime_ms = UINT32_MAX;
+  for (Wind_History_window_t window = Wind_History_window_short; window < Wind_History_num_of_windows; window++)
   {
-    printf("error telegram invalid\r\n");
-    printf("%s\r\n", received_NMEA_telegramm);
+    Wind_History_get_statistics(&WSWD_history, window, now_ms, &WSWD_statistics[window]);
+    time_to_expiry = Wind_History_get_time_to_expiry(&WSWD_history, window, now_ms);
+    if (time_to_expiry < WSWD_statistics_lifetime_ms)
+    {
+      WSWD_statistics_lifetime_ms = time_to_expiry;
+    }
   }
 }
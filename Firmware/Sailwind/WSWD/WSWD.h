@@ -1,54 +1,124 @@
 /**
  * \file WSWD.h
  * @date 18 Jun 2023
- * @brief Access to Analog and Digital IO Pins
+ * @brief Access to the wind sensor (WSWD) over rs485
+ *
+ * The NMEA telegrams of the sensor are received in the background by DMA and buffered in a ring buffer.
+ * WSWD_update passes them to the NMEA parser, keeps the wind values of the last valid telegram
+ * and adds them to the wind history, so readers never wait for the UART. The statistics of the
+ * history are recomputed there as well, only after a new sample or when a sample leaves a window.
  */
 
 #ifndef WSWD_WSWD_H_
 #define WSWD_WSWD_H_
 
+#include "stm32f4xx_hal.h"
+#include "boolean.h"
+#include "NMEA.h"
+#include "Wind_History.h"
+
+/* defines -----------------------------------------------------------*/
+#define WSWD_DMA_BUFFER_SIZE    64U   /* circular DMA buffer of the UART reception */
+#define WSWD_RING_BUFFER_SIZE   256U  /* received bytes not yet framed, has to be a power of 2 */
+#define WSWD_SAMPLE_TIMEOUT_MS  3000U /* a sample older than this is reported as stale */
+#define WSWD_WINDOW_SHORT_MS    3000U   /* gust window */
+#define WSWD_WINDOW_LONG_MS     120000U /* mean wind window, limited to WIND_HISTORY_SIZE samples */
+#define WSWD_GUST_DELTA_X100    500U    /* 5.00 speed units above the mean wind */
+
+#define WSWD_OK                 0
+#define WSWD_ERROR              1
+#define WSWD_NO_DATA            2
+
+/* typedefs -----------------------------------------------------------*/
+
+/** @struct WSWD_wind_sample_t
+ *  @brief wind values of the last valid NMEA telegram
+ *  @var WSWD_wind_sample_t::speed_x100
+ *  wind speed in 0.01 of unit
+ *  @var WSWD_wind_sample_t::direction_x10
+ *  wind direction in 0.1 degree
+ *  @var WSWD_wind_sample_t::unit
+ *  wind speed unit configured on the sensor
+ *  @var WSWD_wind_sample_t::timestamp_ms
+ *  HAL tick at which the telegram was completed
+ *  @var WSWD_wind_sample_t::is_valid
+ *  False until the first valid telegram has been received
+ */
+typedef struct {
+  uint32_t speed_x100;
+  uint16_t direction_x10;
+  NMEA_unit_t unit;
+  uint32_t timestamp_ms;
+  boolean_t is_valid;
+} WSWD_wind_sample_t;
+
+/* API function prototypes -----------------------------------------------*/
+
 /**
- * @brief send a command code over rs485
- * @param command:ptr to a string containing the command
- * @retval succes or fail
+ * @brief start the background reception of the wind sensor (DMA with idle line detection)
+ * @param huart_ptr: ptr to the uart instance connected to the rs485 transceiver
+ * @retval WSWD_OK or WSWD_ERROR
  */
-uint8_t WSWD_send_without_param(char* command);
+uint8_t WSWD_init(UART_HandleTypeDef *huart_ptr);
 
 /**
- * @brief send a command code with an additional parameter over rs485
- * @param command:ptr to a string containing the command
- * @param param:ptr to a string containing the additional parameter
- * @retval succes or fail
+ * @brief frame the bytes received since the last call into NMEA sentences and
+ *        store the wind values of every valid telegram. Has to be called cyclically.
+ * @param none
+ * @retval none
  */
-uint8_t WSWD_send_with_param(char* command, char* param);
+void WSWD_update(void);
 
 /**
- * @brief receive an anwser over rs485
- * @param receive_buffer:ptr to a string buffer for the received message
- * @param size_of_receive_buffer:size of the receive buffer
- * @retval succes or fail
+ * @brief get the wind values of the last valid telegram (non blocking)
+ * @param sample: ptr to the destination sample
+ * @retval WSWD_OK, WSWD_NO_DATA (no telegram yet or older than WSWD_SAMPLE_TIMEOUT_MS)
  */
-uint8_t WSWD_receive(char* receive_buffer, uint8_t size_of_receive_buffer);
+uint8_t WSWD_get_latest_sample(WSWD_wind_sample_t *sample);
 
 /**
- * @brief extract windspeed and direction from a received NMEA telegram
- * @param received_NMEA_telegramm:ptr to the received NMEA telegram
- * @param Windspeed:Windspeed extracted from telegram
- * @param Winddirection:Winddirection extracted from telegram
+ * @brief get the rolling statistics of a window of the wind history as of the last WSWD_update
+ * @param window: Wind_History_window_short or Wind_History_window_long
+ * @param statistics: ptr to the destination
+ * @retval WSWD_OK, WSWD_NO_DATA (no sample inside the window)
+ */
+uint8_t WSWD_get_wind_statistics(Wind_History_window_t window, Wind_History_statistics_t *statistics);
+
+/**
+ * @brief get the state of the gust detection
+ * @param gust: ptr to the destination
+ * @retval none
+ */
+void WSWD_get_gust(Wind_History_gust_t *gust);
+
+/**
+ * @brief has to be called in HAL_UARTEx_RxEventCallback
+ * @param huart_ptr: ptr to the uart instance that raised the event
+ * @param position: position of the DMA in the receive buffer
  * @retval none
  */
-void WSWD_get_wind_infos(char* received_NMEA_telegramm, float *Windspeed,  float *Winddirection);
+void WSWD_callback_receive_event(UART_HandleTypeDef *huart_ptr, uint16_t position);
 
 /**
- * @brief extract the windspeed unit from a received NMEA telegram
- * @param received_NMEA_telegramm:ptr to the received NMEA telegram
- * @param unit:unit extracted from telegram
+ * @brief has to be called in HAL_UART_ErrorCallback, restarts the reception
+ * @param huart_ptr: ptr to the uart instance that raised the error
  * @retval none
  */
-void WSWD_get_windspeed_unit(char* received_NMEA_telegramm, char unit);
+void WSWD_callback_error(UART_HandleTypeDef *huart_ptr);
 
-uint8_t WSWD_receive_NMEA(char* receive_buffer);
-void WSWD_get_wind_speed(char* received_NMEA_telegramm, float *Windspeed);
-void WSWD_get_wind_dir(char* received_NMEA_telegramm, float *Winddirection);
+/**
+ * @brief send a command code over rs485
+ * @param command:ptr to a string containing the command
+ * @retval succes or fail
+ */
+uint8_t WSWD_send_without_param(char* command);
+
+/**
+ * @brief send a command code with an additional parameter over rs485
+ * @param command:ptr to a string containing the command
+ * @param param:ptr to a string containing the additional parameter
+ * @retval succes or fail
+ */
+uint8_t WSWD_send_with_param(char* command, char* param);
 
 #endif /* WSWD_WSWD_H_ */
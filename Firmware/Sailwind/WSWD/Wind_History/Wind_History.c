@@ -0,0 +1,221 @@
+/**
+ * \file Wind_History.c
+ * @date 17 Oct 2026
+ * @brief Circular history of wind samples with rolling statistics and gust detection
+ */
+#include "Wind_History.h"
+#include <math.h>
+#include <string.h>
+
+/* defines -----------------------------------------------------------*/
+#define WIND_HISTORY_PI             3.14159265f
+#define WIND_HISTORY_FULL_CIRCLE    3600U  /* 360 degree in 0.1 degree */
+
+/* private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief get the sample with a sequence number
+ * @param history_ptr: ptr to the history instance
+ * @param seq: sequence number of the sample
+ * @retval ptr to the sample
+ */
+static Wind_History_sample_t *Wind_History_sample(Wind_History_t *history_ptr, uint32_t seq);
+
+/**
+ * @brief add the newest sample to the aggregates of a window
+ * @param history_ptr: ptr to the history instance
+ * @param window_ptr: ptr to the window
+ * @param seq: sequence number of the sample
+ * @retval none
+ */
+static void Wind_History_window_push(Wind_History_t *history_ptr, Wind_History_window_state_t *window_ptr, uint32_t seq);
+
+/**
+ * @brief remove the oldest sample from the aggregates of a window
+ * @param history_ptr: ptr to the history instance
+ * @param window_ptr: ptr to the window
+ * @retval none
+ */
+static void Wind_History_window_pop(Wind_History_t *history_ptr, Wind_History_window_state_t *window_ptr);
+
+/**
+ * @brief remove all samples older than the duration of a window
+ * @param history_ptr: ptr to the history instance
+ * @param window_ptr: ptr to the window
+ * @param now_ms: current time
+ * @retval none
+ */
+static void Wind_History_window_expire(Wind_History_t *history_ptr, Wind_History_window_state_t *window_ptr, uint32_t now_ms);
+
+/**
+ * @brief mean speed of a window
+ * @param history_ptr: ptr to the history instance
+ * @param window_ptr: ptr to the window
+ * @retval mean speed in 0.01 speed unit, 0 for an empty window
+ */
+static uint32_t Wind_History_window_mean(Wind_History_t *history_ptr, Wind_History_window_state_t *window_ptr);
+
+/**
+ * @brief start, follow and end a gust after a new sample
+ * @param history_ptr: ptr to the history instance
+ * @param sample_ptr: ptr to the new sample
+ * @retval none
+ */
+static void Wind_History_detect_gust(Wind_History_t *history_ptr, const Wind_History_sample_t *sample_ptr);
+
+/* API function definitions -----------------------------------------------*/
+
+void Wind_History_init(Wind_History_t *history_ptr, const Wind_History_config_t *config_ptr) {
+  memset(history_ptr, 0, sizeof(Wind_History_t));
+  for (uint8_t i = 0U; i < Wind_History_num_of_windows; i++) {
+    history_ptr->windows[i].duration_ms = config_ptr->window_durations_ms[i];
+  }
+  history_ptr->gust_delta_x100 = config_ptr->gust_delta_x100;
+}
+
+void Wind_History_add(Wind_History_t *history_ptr, uint32_t timestamp_ms,
+                      uint32_t speed_x100, uint16_t direction_x10) {
+  uint32_t seq = history_ptr->next_seq;
+  Wind_History_sample_t *sample_ptr = Wind_History_sample(history_ptr, seq);
+  float direction_rad = (float) direction_x10 * WIND_HISTORY_PI / (WIND_HISTORY_FULL_CIRCLE / 2U);
+
+  for (uint8_t i = 0U; i < Wind_History_num_of_windows; i++) {
+    /* the slot is overwritten, so its sample has to leave every window first */
+    if (seq - history_ptr->windows[i].first_seq >= WIND_HISTORY_SIZE) {
+      Wind_History_window_pop(history_ptr, &history_ptr->windows[i]);
+    }
+  }
+  sample_ptr->timestamp_ms = timestamp_ms;
+  sample_ptr->speed_x100 = speed_x100;
+  sample_ptr->direction_x10 = direction_x10;
+  sample_ptr->sin_scaled = (int16_t) lroundf(sinf(direction_rad) * WIND_HISTORY_VECTOR_SCALE);
+  sample_ptr->cos_scaled = (int16_t) lroundf(cosf(direction_rad) * WIND_HISTORY_VECTOR_SCALE);
+  history_ptr->next_seq++;
+
+  for (uint8_t i = 0U; i < Wind_History_num_of_windows; i++) {
+    Wind_History_window_push(history_ptr, &history_ptr->windows[i], seq);
+    Wind_History_window_expire(history_ptr, &history_ptr->windows[i], timestamp_ms);
+  }
+  Wind_History_detect_gust(history_ptr, sample_ptr);
+}
+
+void Wind_History_get_statistics(Wind_History_t *history_ptr, Wind_History_window_t window,
+                                 uint32_t now_ms, Wind_History_statistics_t *statistics_ptr) {
+  Wind_History_window_state_t *window_ptr = &history_ptr->windows[window];
+  uint32_t num_of_samples = 0U;
+  float direction_deg = 0.0f;
+  float resultant = 0.0f;
+
+  Wind_History_window_expire(history_ptr, window_ptr, now_ms);
+  memset(statistics_ptr, 0, sizeof(Wind_History_statistics_t));
+  statistics_ptr->duration_ms = window_ptr->duration_ms;
+  num_of_samples = history_ptr->next_seq - window_ptr->first_seq;
+  if (num_of_samples == 0U) {
+    return;
+  }
+  statistics_ptr->num_of_samples = (uint16_t) num_of_samples;
+  statistics_ptr->mean_speed_x100 = Wind_History_window_mean(history_ptr, window_ptr);
+  statistics_ptr->max_speed_x100 = Wind_History_sample(
+      history_ptr, window_ptr->max_queue[window_ptr->max_head % WIND_HISTORY_SIZE])->speed_x100;
+  statistics_ptr->speed_variance_x10000 = (uint32_t) ((num_of_samples * window_ptr->sum_speed_sq
+      - window_ptr->sum_speed * window_ptr->sum_speed) / ((uint64_t) num_of_samples * num_of_samples));
+
+  direction_deg = atan2f((float) window_ptr->sum_sin, (float) window_ptr->sum_cos) * 180.0f / WIND_HISTORY_PI;
+  if (direction_deg < 0.0f) {
+    direction_deg += 360.0f;
+  }
+  statistics_ptr->mean_direction_x10 = (uint16_t) (lroundf(direction_deg * 10.0f) % WIND_HISTORY_FULL_CIRCLE);
+  resultant = hypotf((float) window_ptr->sum_sin, (float) window_ptr->sum_cos)
+      / ((float) num_of_samples * WIND_HISTORY_VECTOR_SCALE);
+  statistics_ptr->steadiness_x1000 = (uint16_t) lroundf(resultant * 1000.0f);
+}
+
+uint32_t Wind_History_get_time_to_expiry(const Wind_History_t *history_ptr, Wind_History_window_t window,
+                                         uint32_t now_ms) {
+  const Wind_History_window_state_t *window_ptr = &history_ptr->windows[window];
+  uint32_t age_ms;
+
+  if (window_ptr->first_seq == history_ptr->next_seq) {
+    return UINT32_MAX;
+  }
+  /* a sample is dropped once it is older than the duration */
+  age_ms = now_ms - history_ptr->samples[window_ptr->first_seq % WIND_HISTORY_SIZE].timestamp_ms;
+  return (age_ms > window_ptr->duration_ms) ? 0U : window_ptr->duration_ms + 1U - age_ms;
+}
+
+/* private function definitions -----------------------------------------------*/
+
+static Wind_History_sample_t *Wind_History_sample(Wind_History_t *history_ptr, uint32_t seq) {
+  return &history_ptr->samples[seq % WIND_HISTORY_SIZE];
+}
+
+static void Wind_History_window_push(Wind_History_t *history_ptr, Wind_History_window_state_t *window_ptr, uint32_t seq) {
+  Wind_History_sample_t *sample_ptr = Wind_History_sample(history_ptr, seq);
+
+  window_ptr->sum_speed += sample_ptr->speed_x100;
+  window_ptr->sum_speed_sq += (uint64_t) sample_ptr->speed_x100 * sample_ptr->speed_x100;
+  window_ptr->sum_sin += sample_ptr->sin_scaled;
+  window_ptr->sum_cos += sample_ptr->cos_scaled;
+
+  /* samples that are not faster than the new one can never become the maximum again */
+  while (window_ptr->max_tail != window_ptr->max_head
+      && Wind_History_sample(history_ptr, window_ptr->max_queue[(window_ptr->max_tail - 1U) % WIND_HISTORY_SIZE])->speed_x100
+          <= sample_ptr->speed_x100) {
+    window_ptr->max_tail--;
+  }
+  window_ptr->max_queue[window_ptr->max_tail % WIND_HISTORY_SIZE] = seq;
+  window_ptr->max_tail++;
+}
+
+static void Wind_History_window_pop(Wind_History_t *history_ptr, Wind_History_window_state_t *window_ptr) {
+  Wind_History_sample_t *sample_ptr = Wind_History_sample(history_ptr, window_ptr->first_seq);
+
+  window_ptr->sum_speed -= sample_ptr->speed_x100;
+  window_ptr->sum_speed_sq -= (uint64_t) sample_ptr->speed_x100 * sample_ptr->speed_x100;
+  window_ptr->sum_sin -= sample_ptr->sin_scaled;
+  window_ptr->sum_cos -= sample_ptr->cos_scaled;
+  if (window_ptr->max_tail != window_ptr->max_head
+      && window_ptr->max_queue[window_ptr->max_head % WIND_HISTORY_SIZE] == window_ptr->first_seq) {
+    window_ptr->max_head++;
+  }
+  window_ptr->first_seq++;
+}
+
+static void Wind_History_window_expire(Wind_History_t *history_ptr, Wind_History_window_state_t *window_ptr, uint32_t now_ms) {
+  while (window_ptr->first_seq != history_ptr->next_seq
+      && now_ms - Wind_History_sample(history_ptr, window_ptr->first_seq)->timestamp_ms > window_ptr->duration_ms) {
+    Wind_History_window_pop(history_ptr, window_ptr);
+  }
+}
+
+static uint32_t Wind_History_window_mean(Wind_History_t *history_ptr, Wind_History_window_state_t *window_ptr) {
+  uint32_t num_of_samples = history_ptr->next_seq - window_ptr->first_seq;
+
+  if (num_of_samples == 0U) {
+    return 0U;
+  }
+  return (uint32_t) ((window_ptr->sum_speed + num_of_samples / 2U) / num_of_samples);
+}
+
+static void Wind_History_detect_gust(Wind_History_t *history_ptr, const Wind_History_sample_t *sample_ptr) {
+  Wind_History_gust_t *gust_ptr = &history_ptr->gust;
+  uint32_t short_mean = Wind_History_window_mean(history_ptr, &history_ptr->windows[Wind_History_window_short]);
+  uint32_t long_mean = Wind_History_window_mean(history_ptr, &history_ptr->windows[Wind_History_window_long]);
+
+  if (!gust_ptr->is_active) {
+    if (short_mean >= long_mean + history_ptr->gust_delta_x100) {
+      gust_ptr->is_active = True;
+      gust_ptr->count++;
+      gust_ptr->peak_speed_x100 = sample_ptr->speed_x100;
+      gust_ptr->timestamp_ms = sample_ptr->timestamp_ms;
+    }
+    return;
+  }
+  if (sample_ptr->speed_x100 > gust_ptr->peak_speed_x100) {
+    gust_ptr->peak_speed_x100 = sample_ptr->speed_x100;
+  }
+  /* hysteresis of half the threshold, so a gust at the threshold is not counted repeatedly */
+  if (short_mean < long_mean + history_ptr->gust_delta_x100 / 2U) {
+    gust_ptr->is_active = False;
+  }
+}
@@ -0,0 +1,206 @@
+/**
+ * \file Wind_History.h
+ * @date 17 Oct 2026
+ * @brief Circular history of wind samples with rolling statistics and gust detection
+ *
+ * Every window keeps running sums over the samples of its duration, so mean, variance and the
+ * vector averaged direction are updated in O(1) per sample. The maximum is kept in a monotonic queue
+ * (amortized O(1)). A gust is reported while the mean of the short window exceeds the mean of the
+ * long window by the configured delta.
+ * It has no hardware dependencies, the time is passed in by the caller.
+ */
+
+#ifndef WSWD_WIND_HISTORY_H_
+#define WSWD_WIND_HISTORY_H_
+
+#include <stdint.h>
+#include "boolean.h"
+
+/* defines -----------------------------------------------------------*/
+#define WIND_HISTORY_SIZE           128U   /* number of samples kept, limits the length of every window */
+#define WIND_HISTORY_VECTOR_SCALE   10000  /* scale of the stored unit vector of the direction */
+
+/* typedefs -----------------------------------------------------------*/
+
+typedef enum {
+  Wind_History_window_short,
+  Wind_History_window_long,
+  Wind_History_num_of_windows
+} Wind_History_window_t;
+
+/** @struct Wind_History_config_t
+ *  @brief settings of the history
+ *  @var Wind_History_config_t::window_durations_ms
+ *  time span of every window
+ *  @var Wind_History_config_t::gust_delta_x100
+ *  minimum excess of the short window mean over the long window mean for a gust (0.01 speed unit)
+ */
+typedef struct {
+  uint32_t window_durations_ms[Wind_History_num_of_windows];
+  uint32_t gust_delta_x100;
+} Wind_History_config_t;
+
+/** @struct Wind_History_sample_t
+ *  @brief one wind measurement
+ *  @var Wind_History_sample_t::timestamp_ms
+ *  time of the measurement
+ *  @var Wind_History_sample_t::speed_x100
+ *  wind speed in 0.01 speed unit
+ *  @var Wind_History_sample_t::direction_x10
+ *  wind direction in 0.1 degree
+ *  @var Wind_History_sample_t::sin_scaled
+ *  sine of the direction * WIND_HISTORY_VECTOR_SCALE
+ *  @var Wind_History_sample_t::cos_scaled
+ *  cosine of the direction * WIND_HISTORY_VECTOR_SCALE
+ */
+typedef struct {
+  uint32_t timestamp_ms;
+  uint32_t speed_x100;
+  uint16_t direction_x10;
+  int16_t sin_scaled;
+  int16_t cos_scaled;
+} Wind_History_sample_t;
+
+/** @struct Wind_History_window_state_t
+ *  @brief running aggregates of one window
+ *  @var Wind_History_window_state_t::duration_ms
+ *  time span of the window
+ *  @var Wind_History_window_state_t::first_seq
+ *  sequence number of the oldest sample inside the window
+ *  @var Wind_History_window_state_t::sum_speed
+ *  sum of speed_x100
+ *  @var Wind_History_window_state_t::sum_speed_sq
+ *  sum of speed_x100^2
+ *  @var Wind_History_window_state_t::sum_sin
+ *  sum of sin_scaled
+ *  @var Wind_History_window_state_t::sum_cos
+ *  sum of cos_scaled
+ *  @var Wind_History_window_state_t::max_queue
+ *  sequence numbers with decreasing speed, the front is the maximum of the window
+ *  @var Wind_History_window_state_t::max_head
+ *  front of max_queue
+ *  @var Wind_History_window_state_t::max_tail
+ *  end of max_queue
+ */
+typedef struct {
+  uint32_t duration_ms;
+  uint32_t first_seq;
+  uint64_t sum_speed;
+  uint64_t sum_speed_sq;
+  int32_t sum_sin;
+  int32_t sum_cos;
+  uint32_t max_queue[WIND_HISTORY_SIZE];
+  uint32_t max_head;
+  uint32_t max_tail;
+} Wind_History_window_state_t;
+
+/** @struct Wind_History_gust_t
+ *  @brief state of the gust detection
+ *  @var Wind_History_gust_t::is_active
+ *  a gust is in progress
+ *  @var Wind_History_gust_t::count
+ *  number of gusts since init
+ *  @var Wind_History_gust_t::peak_speed_x100
+ *  highest speed of the current or last gust
+ *  @var Wind_History_gust_t::timestamp_ms
+ *  start of the current or last gust
+ */
+typedef struct {
+  boolean_t is_active;
+  uint32_t count;
+  uint32_t peak_speed_x100;
+  uint32_t timestamp_ms;
+} Wind_History_gust_t;
+
+/** @struct Wind_History_t
+ *  @brief sample buffer, windows and gust state
+ *  @var Wind_History_t::samples
+ *  circular buffer, sample seq is stored at samples[seq % WIND_HISTORY_SIZE]
+ *  @var Wind_History_t::next_seq
+ *  sequence number of the next sample
+ *  @var Wind_History_t::windows
+ *  aggregates of every window
+ *  @var Wind_History_t::gust_delta_x100
+ *  see Wind_History_config_t::gust_delta_x100
+ *  @var Wind_History_t::gust
+ *  state of the gust detection
+ */
+typedef struct {
+  Wind_History_sample_t samples[WIND_HISTORY_SIZE];
+  uint32_t next_seq;
+  Wind_History_window_state_t windows[Wind_History_num_of_windows];
+  uint32_t gust_delta_x100;
+  Wind_History_gust_t gust;
+} Wind_History_t;
+
+/** @struct Wind_History_statistics_t
+ *  @brief aggregates of one window
+ *  @var Wind_History_statistics_t::duration_ms
+ *  time span of the window
+ *  @var Wind_History_statistics_t::num_of_samples
+ *  number of samples inside the window
+ *  @var Wind_History_statistics_t::mean_speed_x100
+ *  mean wind speed in 0.01 speed unit
+ *  @var Wind_History_statistics_t::max_speed_x100
+ *  maximum wind speed in 0.01 speed unit
+ *  @var Wind_History_statistics_t::speed_variance_x10000
+ *  variance of the wind speed in 0.0001 speed unit^2
+ *  @var Wind_History_statistics_t::mean_direction_x10
+ *  vector averaged wind direction in 0.1 degree
+ *  @var Wind_History_statistics_t::steadiness_x1000
+ *  length of the mean direction vector (1000: constant direction, 0: no prevailing direction)
+ */
+typedef struct {
+  uint32_t duration_ms;
+  uint16_t num_of_samples;
+  uint32_t mean_speed_x100;
+  uint32_t max_speed_x100;
+  uint32_t speed_variance_x10000;
+  uint16_t mean_direction_x10;
+  uint16_t steadiness_x1000;
+} Wind_History_statistics_t;
+
+/* API function prototypes -----------------------------------------------*/
+
+/**
+ * @brief clear the history and apply the window durations and the gust threshold
+ * @param history_ptr: ptr to the history instance
+ * @param config_ptr: ptr to the settings
+ * @retval none
+ */
+void Wind_History_init(Wind_History_t *history_ptr, const Wind_History_config_t *config_ptr);
+
+/**
+ * @brief append a sample, update all windows and the gust detection
+ * @param history_ptr: ptr to the history instance
+ * @param timestamp_ms: time of the measurement
+ * @param speed_x100: wind speed in 0.01 speed unit
+ * @param direction_x10: wind direction in 0.1 degree
+ * @retval none
+ */
+void Wind_History_add(Wind_History_t *history_ptr, uint32_t timestamp_ms,
+                      uint32_t speed_x100, uint16_t direction_x10);
+
+/**
+ * @brief drop the samples older than the window and compute its aggregates
+ * @param history_ptr: ptr to the history instance
+ * @param window: window to evaluate
+ * @param now_ms: current time
+ * @param statistics_ptr: ptr to the destination
+ * @retval none
+ */
+void Wind_History_get_statistics(Wind_History_t *history_ptr, Wind_History_window_t window,
+                                 uint32_t now_ms, Wind_History_statistics_t *statistics_ptr);
+
+/**
+ * @brief get the time until the oldest sample of a window leaves it, the statistics of the window
+ *        only change with a new sample or at this time
+ * @param history_ptr: ptr to the history instance
+ * @param window: window to evaluate
+ * @param now_ms: current time, not before the last Wind_History_get_statistics of the window
+ * @retval time in ms, UINT32_MAX for an empty window
+ */
+uint32_t Wind_History_get_time_to_expiry(const Wind_History_t *history_ptr, Wind_History_window_t window,
+                                         uint32_t now_ms);
+
+#endif /* WSWD_WIND_HISTORY_H_ */
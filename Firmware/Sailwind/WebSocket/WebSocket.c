@@ -0,0 +1,197 @@
+/**
+ * \file WebSocket.c
+ * @date 17 Oct 2026
+ * @brief Opening handshake and framing of RFC 6455 WebSocket connections
+ */
+#include <string.h>
+#include "WebSocket.h"
+
+/* defines -----------------------------------------------------------*/
+#define WEBSOCKET_GUID            "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+#define WEBSOCKET_MAX_KEY_LENGTH  24U   /* base64 of the 16 byte nonce */
+#define WEBSOCKET_FIN             0x80U
+#define WEBSOCKET_RSV             0x70U
+#define WEBSOCKET_OPCODE          0x0FU
+#define WEBSOCKET_MASK            0x80U
+#define WEBSOCKET_LENGTH_16       126U
+#define WEBSOCKET_CONTROL_FRAME   0x08U  /* opcodes with this bit are control frames */
+
+#define SHA1_BLOCK_SIZE           64U
+#define SHA1_DIGEST_SIZE          20U
+#define SHA1_ROTATE(x, n)         (((x) << (n)) | ((x) >> (32U - (n))))
+
+/* private function prototypes -----------------------------------------------*/
+
+/**
+ * @brief calculate the SHA-1 of a message of at most two blocks
+ * @param message: ptr to the message
+ * @param length: length of the message, less than 2 * SHA1_BLOCK_SIZE - 8
+ * @param digest: destination of SHA1_DIGEST_SIZE bytes
+ * @retval none
+ */
+static void WebSocket_sha1(const uint8_t *message, size_t length, uint8_t *digest);
+
+/**
+ * @brief process one block of the SHA-1
+ * @param state: intermediate hash
+ * @param block: ptr to SHA1_BLOCK_SIZE bytes
+ * @retval none
+ */
+static void WebSocket_sha1_block(uint32_t *state, const uint8_t *block);
+
+/**
+ * @brief encode bytes in base64 with padding
+ * @param data: ptr to the bytes
+ * @param length: number of bytes
+ * @param text: destination, null terminated
+ * @retval none
+ */
+static void WebSocket_base64(const uint8_t *data, size_t length, char *text);
+
+/* API function definitions -----------------------------------------------*/
+
+void WebSocket_create_accept(const char *key, size_t key_length, char *accept) {
+  uint8_t message[WEBSOCKET_MAX_KEY_LENGTH + sizeof(WEBSOCKET_GUID) - 1U];
+  uint8_t digest[SHA1_DIGEST_SIZE];
+
+  /* a longer key is not a valid nonce, it is cut so the message fits */
+  if (key_length > WEBSOCKET_MAX_KEY_LENGTH) {
+    key_length = WEBSOCKET_MAX_KEY_LENGTH;
+  }
+  memcpy(message, key, key_length);
+  memcpy(&message[key_length], WEBSOCKET_GUID, strlen(WEBSOCKET_GUID));
+  WebSocket_sha1(message, key_length + strlen(WEBSOCKET_GUID), digest);
+  WebSocket_base64(digest, sizeof(digest), accept);
+}
+
+size_t WebSocket_encode(uint8_t *buffer, size_t size, uint8_t opcode, const void *payload, size_t length) {
+  size_t header_length = (length < WEBSOCKET_LENGTH_16) ? 2U : WEBSOCKET_MAX_HEADER_SIZE;
+
+  if (length > UINT16_MAX || size < header_length + length) {
+    return 0U;
+  }
+  /* memmove, the payload may already be in the buffer */
+  memmove(&buffer[header_length], payload, length);
+  buffer[0] = WEBSOCKET_FIN | opcode;
+  if (header_length == 2U) {
+    buffer[1] = (uint8_t) length;
+  } else {
+    buffer[1] = WEBSOCKET_LENGTH_16;
+    buffer[2] = (uint8_t) (length >> 8);
+    buffer[3] = (uint8_t) length;
+  }
+  return header_length + length;
+}
+
+int8_t WebSocket_decode(const uint8_t *buffer, size_t length, WebSocket_frame_t *frame_ptr, size_t *consumed_ptr) {
+  const uint8_t *mask = &buffer[2];
+  uint8_t payload_length;
+
+  *consumed_ptr = 0U;
+  if (length < 2U) {
+    return WEBSOCKET_FRAME_INCOMPLETE;
+  }
+  payload_length = buffer[1] & ~WEBSOCKET_MASK;
+  /* every client frame is masked, messages are not fragmented and fit into the 7 bit length */
+  if ((buffer[0] & WEBSOCKET_FIN) == 0U || (buffer[0] & WEBSOCKET_RSV) != 0U
+      || (buffer[1] & WEBSOCKET_MASK) == 0U || payload_length > WEBSOCKET_MAX_PAYLOAD) {
+    return WEBSOCKET_FRAME_INVALID;
+  }
+  frame_ptr->opcode = buffer[0] & WEBSOCKET_OPCODE;
+  if (frame_ptr->opcode != WEBSOCKET_OPCODE_TEXT && frame_ptr->opcode != WEBSOCKET_OPCODE_BINARY
+      && (frame_ptr->opcode & WEBSOCKET_CONTROL_FRAME) == 0U) {
+    /* continuation or reserved opcode */
+    return WEBSOCKET_FRAME_INVALID;
+  }
+  if (length < 2U + WEBSOCKET_MASK_SIZE + payload_length) {
+    return WEBSOCKET_FRAME_INCOMPLETE;
+  }
+  for (uint8_t i = 0U; i < payload_length; i++) {
+    frame_ptr->payload[i] = (char) (buffer[2U + WEBSOCKET_MASK_SIZE + i] ^ mask[i % WEBSOCKET_MASK_SIZE]);
+  }
+  frame_ptr->payload[payload_length] = '\0';
+  frame_ptr->length = payload_length;
+  *consumed_ptr = 2U + WEBSOCKET_MASK_SIZE + payload_length;
+  return WEBSOCKET_FRAME_COMPLETE;
+}
+
+/* private function definitions -----------------------------------------------*/
+
+static void WebSocket_sha1(const uint8_t *message, size_t length, uint8_t *digest) {
+  uint32_t state[5] = { 0x67452301UL, 0xEFCDAB89UL, 0x98BADCFEUL, 0x10325476UL, 0xC3D2E1F0UL };
+  uint8_t blocks[2U * SHA1_BLOCK_SIZE] = { 0 };
+  size_t num_of_blocks = (length + 9U > SHA1_BLOCK_SIZE) ? 2U : 1U;
+  uint32_t bits = (uint32_t) length * 8U;
+  size_t end = num_of_blocks * SHA1_BLOCK_SIZE;
+
+  /* padding: 0x80, zeros and the big endian bit length in the last 8 bytes */
+  memcpy(blocks, message, length);
+  blocks[length] = 0x80U;
+  blocks[end - 4U] = (uint8_t) (bits >> 24);
+  blocks[end - 3U] = (uint8_t) (bits >> 16);
+  blocks[end - 2U] = (uint8_t) (bits >> 8);
+  blocks[end - 1U] = (uint8_t) bits;
+  for (size_t i = 0U; i < num_of_blocks; i++) {
+    WebSocket_sha1_block(state, &blocks[i * SHA1_BLOCK_SIZE]);
+  }
+  for (uint8_t i = 0U; i < SHA1_DIGEST_SIZE; i++) {
+    digest[i] = (uint8_t) (state[i / 4U] >> (24U - 8U * (i % 4U)));
+  }
+}
+
+static void WebSocket_sha1_block(uint32_t *state, const uint8_t *block) {
+  uint32_t w[80];
+  uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+  uint32_t f, k, temp;
+
+  for (uint8_t i = 0U; i < 16U; i++) {
+    w[i] = ((uint32_t) block[4U * i] << 24) | ((uint32_t) block[4U * i + 1U] << 16)
+        | ((uint32_t) block[4U * i + 2U] << 8) | block[4U * i + 3U];
+  }
+  for (uint8_t i = 16U; i < 80U; i++) {
+    temp = w[i - 3U] ^ w[i - 8U] ^ w[i - 14U] ^ w[i - 16U];
+    w[i] = SHA1_ROTATE(temp, 1U);
+  }
+  for (uint8_t i = 0U; i < 80U; i++) {
+    if (i < 20U) {
+      f = (b & c) | (~b & d);
+      k = 0x5A827999UL;
+    } else if (i < 40U) {
+      f = b ^ c ^ d;
+      k = 0x6ED9EBA1UL;
+    } else if (i < 60U) {
+      f = (b & c) | (b & d) | (c & d);
+      k = 0x8F1BBCDCUL;
+    } else {
+      f = b ^ c ^ d;
+      k = 0xCA62C1D6UL;
+    }
+    temp = SHA1_ROTATE(a, 5U) + f + e + k + w[i];
+    e = d;
+    d = c;
+    c = SHA1_ROTATE(b, 30U);
+    b = a;
+    a = temp;
+  }
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+  state[4] += e;
+}
+
+static void WebSocket_base64(const uint8_t *data, size_t length, char *text) {
+  static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  uint32_t triple;
+
+  for (size_t i = 0U; i < length; i += 3U) {
+    triple = (uint32_t) data[i] << 16;
+    triple |= (i + 1U < length) ? (uint32_t) data[i + 1U] << 8 : 0U;
+    triple |= (i + 2U < length) ? data[i + 2U] : 0U;
+    *text++ = alphabet[(triple >> 18) & 0x3FU];
+    *text++ = alphabet[(triple >> 12) & 0x3FU];
+    *text++ = (i + 1U < length) ? alphabet[(triple >> 6) & 0x3FU] : '=';
+    *text++ = (i + 2U < length) ? alphabet[triple & 0x3FU] : '=';
+  }
+  *text = '\0';
+}
@@ -0,0 +1,88 @@
+/**
+ * \file WebSocket.h
+ * @date 17 Oct 2026
+ * @brief Opening handshake and framing of RFC 6455 WebSocket connections
+ *
+ * Only what the control page needs: the server accepts single frame messages of up to
+ * WEBSOCKET_MAX_PAYLOAD bytes, fragmented or larger client frames are rejected.
+ */
+
+#ifndef WEBSOCKET_WEBSOCKET_H_
+#define WEBSOCKET_WEBSOCKET_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* defines -----------------------------------------------------------*/
+#define WEBSOCKET_ACCEPT_LENGTH       28U   /* base64 of the 20 byte SHA-1 */
+#define WEBSOCKET_MAX_PAYLOAD         125U  /* largest payload with the 7 bit length, also the control frame limit */
+#define WEBSOCKET_MAX_HEADER_SIZE     4U    /* server frame with 16 bit length */
+#define WEBSOCKET_MASK_SIZE           4U
+#define WEBSOCKET_MAX_CLIENT_FRAME    (2U + WEBSOCKET_MASK_SIZE + WEBSOCKET_MAX_PAYLOAD)
+
+/* opcodes */
+#define WEBSOCKET_OPCODE_TEXT         0x1U
+#define WEBSOCKET_OPCODE_BINARY       0x2U
+#define WEBSOCKET_OPCODE_CLOSE        0x8U
+#define WEBSOCKET_OPCODE_PING         0x9U
+#define WEBSOCKET_OPCODE_PONG         0xAU
+
+/* status codes of the close frame */
+#define WEBSOCKET_CLOSE_PROTOCOL_ERROR  1002U
+
+/* result of WebSocket_decode */
+#define WEBSOCKET_FRAME_COMPLETE      0
+#define WEBSOCKET_FRAME_INCOMPLETE    1
+#define WEBSOCKET_FRAME_INVALID       2
+
+/* typedefs -----------------------------------------------------------*/
+
+/** @struct WebSocket_frame_t
+ *  @brief decoded client frame
+ *  @var WebSocket_frame_t::opcode
+ *  WEBSOCKET_OPCODE_x
+ *  @var WebSocket_frame_t::length
+ *  number of payload bytes
+ *  @var WebSocket_frame_t::payload
+ *  unmasked payload, null terminated so text frames can be parsed in place
+ */
+typedef struct {
+  uint8_t opcode;
+  uint8_t length;
+  char payload[WEBSOCKET_MAX_PAYLOAD + 1U];
+} WebSocket_frame_t;
+
+/* API function prototypes -----------------------------------------------*/
+
+/**
+ * @brief calculate the Sec-WebSocket-Accept value of a Sec-WebSocket-Key
+ * @param key: value of the Sec-WebSocket-Key header field
+ * @param key_length: length of the key
+ * @param accept: destination of WEBSOCKET_ACCEPT_LENGTH characters and the terminating null
+ * @retval none
+ */
+void WebSocket_create_accept(const char *key, size_t key_length, char *accept);
+
+/**
+ * @brief write an unmasked server frame
+ * @param buffer: destination
+ * @param size: size of the destination
+ * @param opcode: WEBSOCKET_OPCODE_x
+ * @param payload: ptr to the payload, may be part of buffer behind WEBSOCKET_MAX_HEADER_SIZE
+ * @param length: number of payload bytes
+ * @retval length of the frame, 0 if it does not fit
+ */
+size_t WebSocket_encode(uint8_t *buffer, size_t size, uint8_t opcode, const void *payload, size_t length);
+
+/**
+ * @brief read the first client frame of a buffer
+ * @param buffer: received bytes
+ * @param length: number of received bytes
+ * @param frame_ptr: destination of a complete frame
+ * @param consumed_ptr: number of bytes of the frame
+ * @retval WEBSOCKET_FRAME_COMPLETE, _INCOMPLETE (wait for more bytes)
+ *         or _INVALID (unmasked, fragmented or too long, close the connection)
+ */
+int8_t WebSocket_decode(const uint8_t *buffer, size_t length, WebSocket_frame_t *frame_ptr, size_t *consumed_ptr);
+
+#endif /* WEBSOCKET_WEBSOCKET_H_ */
@@ -7,30 +7,40 @@
 #include <http_ssi_cgi.h>
 #include "string.h"
 #include "stdio.h"
+#include "stdlib.h"
 #include "main.h"
 #include "tcp.h"
 #include "httpd.h"
-#include "IO.h"
 #include "WSWD.h"
+#include "Telemetry.h"
 #include "Linear_Guide.h"
+#include "Command.h"
 #include "FRAM.h"
 #include "lwip.h"
 #include "tcp_server.h"
 #include "FRAM_memory_mapping.h"
 
-#define NUM_SSI_TAGS 12
+#define NUM_SSI_TAGS 15
 #define UINT_TAGS 3
 
-static IO_analogSensor_t *ssi_current_sensor = { 0 };
-static IO_analogSensor_t *ssi_distance_sensor = { 0 };
 static Linear_Guide_t *ssi_linear_guide = { 0 };
 static uint8_t error_flag = 1;
 static uint8_t dhcp = 0;
 char const *TAGCHAR[] = { "current", "dism", "diss", "pos", "windspd",
-    "winddir", "mode", "opmod", "error", "maxrpm", "maxdel", "dhcp" };
+    "winddir", "mode", "opmod", "error", "maxrpm", "maxdel", "dhcp", "windavg",
+    "windmax", "windgst" };
 char const **TAGS = TAGCHAR;
 
 static void http_ssi_cgi_read_dhcp_state(void);
+
+/**
+ * @brief print a wind speed given in 0.01 speed unit with two decimals
+ * @param pcInsert: destination of the SSI tag
+ * @param iInsertLen: size of the destination
+ * @param speed_x100: wind speed in 0.01 speed unit
+ * @retval none
+ */
+static void ssi_print_wind_speed(char *pcInsert, int iInsertLen, uint32_t speed_x100);
 /**
  * @brief Handles the CGI IP form
  * @param iIndex: Index which cgi handler was called
@@ -84,7 +94,7 @@ static const char* CGIdelta_Handler(int iIndex, int iNumParams, char *pcParam[],
 static const char* CGIdhcp_Handler(int iIndex, int iNumParams, char *pcParam[],
                                    char *pcValue[]);
 char name[30];
-static char NMEA_telegram[30];
+static Telemetry_snapshot_t ssi_snapshot;
 tCGI CGI_FORMS[7];
 const tCGI FORM_IP_CGI = { "/form_IP.cgi", CGIIP_Handler };
 const tCGI RESTART_CGI = { "/form_restart.cgi", CGIRestart_Handler };
@@ -96,47 +106,41 @@ const tCGI DHCP_CGI = { "/form_dhcp.cgi", CGIdhcp_Handler };
 
 uint16_t ssi_handler(int iIndex, char *pcInsert, int iInsertLen) {
 
-  float Wind_speed;
-  float Wind_dir;
   int32_t motor_pos;
   LG_operating_mode_t op_mode;
   LG_sail_adjustment_mode_t sail_pos;
   int8_t percentage;
 
+  /* the tags of a page are served from the values of the last control cycle */
+  Telemetry_get_snapshot(&ssi_snapshot);
+
   switch (iIndex) {
     case 0:
-      IO_Get_Measured_Value(ssi_current_sensor);
-      uint16_t current = ssi_current_sensor->measured_value;
-
-      (void) snprintf(pcInsert, iInsertLen, "%u", current);
+      (void) snprintf(pcInsert, iInsertLen, "%u", ssi_snapshot.current_mA);
       break;
     case 1:
-      motor_pos = ssi_linear_guide->localization.current_pos_mm;
-      (void) snprintf(pcInsert, iInsertLen, "%ld", motor_pos);
+      /* mm with three decimals, the sign is written separately for positions between -1 and 0 mm */
+      motor_pos = ssi_snapshot.current_pos_um;
+      (void) snprintf(pcInsert, iInsertLen, "%s%ld.%03ld", (motor_pos < 0) ? "-" : "",
+                      labs(motor_pos) / LOC_UM_PER_MM, labs(motor_pos) % LOC_UM_PER_MM);
       break;
     case 2:
-      IO_Get_Measured_Value(ssi_distance_sensor);
-      Localization_parse_distance_sensor_value(
-          &ssi_linear_guide->localization, ssi_distance_sensor->measured_value);
-      uint16_t distance = ssi_linear_guide->localization.current_measured_pos_mm;
-      (void) snprintf(pcInsert, iInsertLen, "%u", distance);
+      (void) snprintf(pcInsert, iInsertLen, "%u", (uint16_t) ssi_snapshot.measured_pos_mm);
       break;
     case 3:
-      percentage = Linear_Guide_get_current_roll_pitch_percentage(
-          *ssi_linear_guide) * ssi_linear_guide->sail_adjustment_mode;
+      percentage = ssi_snapshot.roll_pitch_percentage * ssi_snapshot.sail_adjustment_mode;
       (void) snprintf(pcInsert, iInsertLen, "%i", percentage);
       break;
     case (UINT_TAGS + 1):
-      WSWD_receive_NMEA(NMEA_telegram);
-      WSWD_get_wind_speed(NMEA_telegram, &Wind_speed);
-      (void) snprintf(pcInsert, iInsertLen, "%.2f", Wind_speed);
+      ssi_print_wind_speed(pcInsert, iInsertLen, ssi_snapshot.wind_sample.speed_x100);
       break;
     case (UINT_TAGS + 2):
-      WSWD_get_wind_dir(NMEA_telegram, &Wind_dir);
-      (void) snprintf(pcInsert, iInsertLen, "%.1f", Wind_dir);
+      (void) snprintf(pcInsert, iInsertLen, "%u.%u",
+                      ssi_snapshot.wind_sample.direction_x10 / NMEA_MWV_ANGLE_SCALE,
+                      ssi_snapshot.wind_sample.direction_x10 % NMEA_MWV_ANGLE_SCALE);
       break;
     case (UINT_TAGS + 3):
-      sail_pos = ssi_linear_guide->sail_adjustment_mode;
+      sail_pos = ssi_snapshot.sail_adjustment_mode;
       switch (sail_pos) {
         case LG_sail_adjustment_mode_roll:
           (void) snprintf(pcInsert, iInsertLen, "%s", "roll");
@@ -150,7 +154,7 @@ uint16_t ssi_handler(int iIndex, char *pcInsert, int iInsertLen) {
       }
       break;
     case (UINT_TAGS + 4):
-      op_mode = ssi_linear_guide->operating_mode;
+      op_mode = ssi_snapshot.operating_mode;
       switch (op_mode) {
         case LG_operating_mode_manual:
           (void) snprintf(pcInsert, iInsertLen, "%s", "manual");
@@ -201,6 +205,17 @@ uint16_t ssi_handler(int iIndex, char *pcInsert, int iInsertLen) {
             "<input type=\"checkbox\" name=\"dhcp\" value=\"true\" style=\"height:35px;width:30px;font-size:15px;\"><br><br>");
       }
       break;
+    case 12:
+      ssi_print_wind_speed(pcInsert, iInsertLen,
+                           ssi_snapshot.wind_statistics[Wind_History_window_long].mean_speed_x100);
+      break;
+    case 13:
+      ssi_print_wind_speed(pcInsert, iInsertLen,
+                           ssi_snapshot.wind_statistics[Wind_History_window_long].max_speed_x100);
+      break;
+    case 14:
+      ssi_print_wind_speed(pcInsert, iInsertLen, ssi_snapshot.gust.peak_speed_x100);
+      break;
     default:
       (void) snprintf(pcInsert, iInsertLen, "Error: Unknown SSI Tag!");
       break;
@@ -208,6 +223,11 @@ uint16_t ssi_handler(int iIndex, char *pcInsert, int iInsertLen) {
   return strlen(pcInsert);
 }
 
+static void ssi_print_wind_speed(char *pcInsert, int iInsertLen, uint32_t speed_x100) {
+  (void) snprintf(pcInsert, iInsertLen, "%lu.%02lu", speed_x100 / NMEA_MWV_SPEED_SCALE,
+                  speed_x100 % NMEA_MWV_SPEED_SCALE);
+}
+
 /************************ CGI HANDLER ***************************/
 
 static const char* CGIIP_Handler(int iIndex, int iNumParams, char *pcParam[],
@@ -288,11 +308,11 @@ static const char* CGIMode_Handler(int iIndex, int iNumParams, char *pcParam[],
       memset(name, '\0', 30);
       strcpy(name, pcValue[0]);
       if (strcmp(name, "automatic") == 0) {
-        Linear_Guide_set_operating_mode(ssi_linear_guide,
-                                        LG_operating_mode_automatic);
+        (void) Command_post(Command_set_operating_mode,
+                            LG_operating_mode_automatic);
       } else if (strcmp(name, "manual") == 0) {
-        Linear_Guide_set_operating_mode(ssi_linear_guide,
-                                        LG_operating_mode_manual);
+        (void) Command_post(Command_set_operating_mode,
+                            LG_operating_mode_manual);
       }
     }
   }
@@ -311,23 +331,23 @@ static const char* CGIControl_Handler(int iIndex, int iNumParams,
           if ((ssi_linear_guide->localization.movement == Loc_movement_forward)
               || (ssi_linear_guide->localization.movement
                   == Loc_movement_backwards)) {
-            Linear_Guide_manual_move(ssi_linear_guide, Loc_movement_stop);
+            (void) Command_post(Command_manual_move, Loc_movement_stop);
           } else {
-            Linear_Guide_manual_move(ssi_linear_guide, Loc_movement_backwards);
+            (void) Command_post(Command_manual_move, Loc_movement_backwards);
           }
         } else if (strcmp(name, "right") == 0) {
           if ((ssi_linear_guide->localization.movement == Loc_movement_forward)
               || (ssi_linear_guide->localization.movement
                   == Loc_movement_backwards)) {
-            Linear_Guide_manual_move(ssi_linear_guide, Loc_movement_stop);
+            (void) Command_post(Command_manual_move, Loc_movement_stop);
           } else {
-            Linear_Guide_manual_move(ssi_linear_guide, Loc_movement_forward);
+            (void) Command_post(Command_manual_move, Loc_movement_forward);
           }
         } else if (strcmp(name, "confirm") == 0) {
           if ((ssi_linear_guide->localization.movement != Loc_movement_backwards)
               || (ssi_linear_guide->localization.movement
                   != Loc_movement_forward)) {
-            Linear_Guide_set_center(ssi_linear_guide);
+            (void) Command_post(Command_set_center, 0);
           } else {
             /* should respond with error feedback*/
             printf("linear guide is still moving\r\n");
@@ -364,9 +384,7 @@ static const char* CGIrpm_Handler(int iIndex, int iNumParams, char *pcParam[],
       }
     }
     rpm_to_be_saved = (uint16_t) rpm_to_be_set;
-    ssi_linear_guide->motor.normal_rpm = rpm_to_be_saved;
-    FRAM_write((uint8_t*) &rpm_to_be_saved, FRAM_MAX_RPM,
-               sizeof(rpm_to_be_saved));
+    (void) Command_post(Command_set_max_rpm, (int16_t) rpm_to_be_saved);
   }
   return "/Settings.shtml";
 }
@@ -395,8 +413,7 @@ static const char* CGIdelta_Handler(int iIndex, int iNumParams, char *pcParam[],
       }
     }
     delta_to_be_saved = (uint8_t) delta_to_be_set;
-    ssi_linear_guide->max_distance_fault = delta_to_be_saved;
-    FRAM_write(&delta_to_be_saved, FRAM_MAX_DELTA, 1U);
+    (void) Command_post(Command_set_max_distance_error, delta_to_be_saved);
   }
   return "/Settings.shtml";
 }
@@ -433,8 +450,6 @@ void http_server_init() {
   CGI_FORMS[5] = DELTA_CGI;
   CGI_FORMS[6] = DHCP_CGI;
   http_set_cgi_handlers(CGI_FORMS, 7);
-  ssi_current_sensor = IO_get_current_sensor();
-  ssi_distance_sensor = IO_get_distance_sensor();
   ssi_linear_guide = LG_get_Linear_Guide();
   http_ssi_cgi_read_dhcp_state();
 }
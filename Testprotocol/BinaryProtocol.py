@@ -0,0 +1,182 @@
+"""Host side reference of the binary protocol (Firmware/Sailwind/Binary_Protocol) and
+latency benchmark against the REST batch endpoint.
+
+usage: python BinaryProtocol.py [ip] [runs]
+       python BinaryProtocol.py listen    (print the published telemetry datagrams)
+"""
+import socket
+import statistics
+import struct
+import sys
+import time
+
+START = 0x5A
+RESPONSE_FLAG = 0x80
+HEADER = struct.Struct("<BBBB")
+CRC = struct.Struct("<H")
+MAX_PAYLOAD = 32
+
+GET_STATE = 0x01
+SET_SAIL_POS = 0x02
+SET_MODE = 0x03
+SET_ERROR = 0x04
+TELEMETRY = 0x10
+
+STATUS = {0: "ok", 1: "invalid value", 2: "unknown command", 3: "crc error", 4: "denied", 5: "busy"}
+
+STATE = struct.Struct("<IhhHHHbBBBB")
+STATE_FIELDS = ("sequence", "position_mm", "measured_position_mm", "current_mA", "wind_speed_x100",
+                "wind_direction_x10", "sail_pos", "error", "operating_mode", "movement", "flags")
+
+TELEMETRY_PAYLOAD = struct.Struct("<IIhhHHHHBBB")
+TELEMETRY_FIELDS = ("sequence", "timestamp_ms", "position_mm", "desired_position_mm", "rpm_set_point",
+                    "current_mA", "wind_speed_x100", "wind_direction_x10", "error", "operating_mode", "flags")
+
+BINARY_PORT = 2376
+REST_PORT = 2375
+PUBLISHER_PORT = 2377
+
+
+def crc16(data: bytes) -> int:
+    """CRC-16/CCITT-FALSE, crc16(b"123456789") == 0x29B1"""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+def encode(command: int, sequence: int, payload: bytes = b"") -> bytes:
+    if len(payload) > MAX_PAYLOAD:
+        raise ValueError("payload too long")
+    frame = HEADER.pack(START, command, sequence & 0xFF, len(payload)) + payload
+    return frame + CRC.pack(crc16(frame))
+
+
+def decode(buffer: bytes):
+    """returns (frame, consumed), frame is (command, sequence, payload) or None if incomplete"""
+    start = buffer.find(bytes([START]))
+    if start < 0:
+        return None, len(buffer)
+    if start > 0:
+        return None, start
+    if len(buffer) < HEADER.size:
+        return None, 0
+    _, command, sequence, length = HEADER.unpack_from(buffer)
+    if length > MAX_PAYLOAD:
+        raise ValueError("invalid length")
+    end = HEADER.size + length
+    if len(buffer) < end + CRC.size:
+        return None, 0
+    if CRC.unpack_from(buffer, end)[0] != crc16(buffer[:end]):
+        raise ValueError("crc error")
+    return (command, sequence, buffer[HEADER.size:end]), end + CRC.size
+
+
+def parse_state(payload: bytes) -> dict:
+    return dict(zip(STATE_FIELDS, STATE.unpack(payload)))
+
+
+def parse_telemetry(payload: bytes) -> dict:
+    return dict(zip(TELEMETRY_FIELDS, TELEMETRY_PAYLOAD.unpack(payload)))
+
+
+def listen(port: int = PUBLISHER_PORT):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(("", port))
+    lost = 0
+    last_sequence = None
+    while True:
+        datagram, sender = sock.recvfrom(256)
+        try:
+            frame, _ = decode(datagram)
+        except ValueError as error:
+            print(f"{sender[0]}: {error}")
+            continue
+        if frame is None or frame[0] != TELEMETRY:
+            continue
+        telemetry = parse_telemetry(frame[2])
+        if last_sequence is not None:
+            lost += (telemetry["sequence"] - last_sequence - 1) & 0xFFFFFFFF
+        last_sequence = telemetry["sequence"]
+        print(f"{sender[0]} lost {lost}: {telemetry}")
+
+
+class BinaryClient:
+    def __init__(self, ip: str, port: int = BINARY_PORT):
+        self.sock = socket.create_connection((ip, port), timeout=2)
+        self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self.sequence = 0
+        self.buffer = b""
+
+    def request(self, command: int, payload: bytes = b""):
+        self.sequence = (self.sequence + 1) & 0xFF
+        self.sock.sendall(encode(command, self.sequence, payload))
+        while True:
+            frame, consumed = decode(self.buffer)
+            self.buffer = self.buffer[consumed:]
+            if frame is not None:
+                return frame
+            if consumed == 0:
+                self.buffer += self.sock.recv(256)
+
+    def get_state(self) -> dict:
+        _, _, payload = self.request(GET_STATE)
+        return parse_state(payload)
+
+    def set_value(self, command: int, value: int) -> str:
+        _, _, payload = self.request(command, struct.pack("<b" if command == SET_SAIL_POS else "<B", value))
+        return STATUS.get(payload[0], "unknown")
+
+
+class RestClient:
+    def __init__(self, ip: str, port: int = REST_PORT):
+        self.ip = ip
+        self.sock = socket.create_connection((ip, port), timeout=2)
+        self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+
+    def get_batch(self) -> bytes:
+        self.sock.sendall(f"GET /data/batch HTTP/1.1\r\nHost: {self.ip}\r\n\r\n".encode())
+        response = b""
+        while b"\r\n\r\n" not in response:
+            response += self.sock.recv(1024)
+        header, body = response.split(b"\r\n\r\n", 1)
+        length = int(header.lower().split(b"content-length:")[1].split(b"\r\n")[0])
+        while len(body) < length:
+            body += self.sock.recv(1024)
+        return body
+
+
+def measure(function, runs: int) -> list:
+    latencies = []
+    for _ in range(runs):
+        start = time.perf_counter()
+        function()
+        latencies.append((time.perf_counter() - start) * 1000)
+    return latencies
+
+
+def print_latencies(name: str, latencies: list):
+    latencies.sort()
+    print(f"{name}: mean {statistics.mean(latencies):.3f} ms, median {statistics.median(latencies):.3f} ms, "
+          f"p99 {latencies[int(len(latencies) * 0.99) - 1]:.3f} ms")
+
+
+def main():
+    if len(sys.argv) > 1 and sys.argv[1] == "listen":
+        listen()
+        return
+    ip = sys.argv[1] if len(sys.argv) > 1 else "192.168.0.123"
+    runs = int(sys.argv[2]) if len(sys.argv) > 2 else 1000
+    assert crc16(b"123456789") == 0x29B1
+    binary = BinaryClient(ip)
+    rest = RestClient(ip)
+    print(binary.get_state())
+    print_latencies("binary GET_STATE", measure(binary.get_state, runs))
+    print_latencies("REST GET /data/batch", measure(rest.get_batch, runs))
+
+
+if __name__ == "__main__":
+    main()